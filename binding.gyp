@@ -7,10 +7,20 @@
       "sources": [
         "src/ndi_addon.cpp",
         "src/ndi_async.cpp",
+        "src/ndi_audio_fifo.cpp",
+        "src/ndi_capture_thread.cpp",
+        "src/ndi_convert.cpp",
+        "src/ndi_executor.cpp",
         "src/ndi_finder.cpp",
+        "src/ndi_frame_mailbox.cpp",
+        "src/ndi_frame_pool.cpp",
+        "src/ndi_send_thread.cpp",
+        "src/ndi_send_watcher.cpp",
         "src/ndi_sender.cpp",
         "src/ndi_receiver.cpp",
-        "src/ndi_utils.cpp"
+        "src/ndi_scale.cpp",
+        "src/ndi_utils.cpp",
+        "src/ndi_video_format.cpp"
       ],
       "include_dirs": [
         "<!@(node -p \"require('node-addon-api').include\")",
@@ -21,6 +31,11 @@
         [
           "OS=='win'",
           {
+            "msvs_settings": {
+              "VCCLCompilerTool": {
+                "AdditionalOptions": ["/std:c++17"]
+              }
+            },
             "libraries": [
               "<(module_root_dir)/deps/ndi/lib/x64/Processing.NDI.Lib.x64.lib"
             ],
@@ -44,6 +59,7 @@
             "xcode_settings": {
               "GCC_ENABLE_CPP_EXCEPTIONS": "YES",
               "CLANG_CXX_LIBRARY": "libc++",
+              "CLANG_CXX_LANGUAGE_STANDARD": "c++17",
               "MACOSX_DEPLOYMENT_TARGET": "10.15"
             }
           }
@@ -33,10 +33,14 @@ export declare const FourCC: {
     readonly BGRX: 'BGRX';
     readonly RGBA: 'RGBA';
     readonly RGBX: 'RGBX';
+    readonly UYVA: 'UYVA';
     readonly I420: 'I420';
+    readonly YV12: 'YV12';
     readonly NV12: 'NV12';
     readonly P216: 'P216';
     readonly PA16: 'PA16';
+    /** 10-bit packed 4:2:2, lines padded to 128 bytes; unpacked to P216 natively when sent */
+    readonly V210: 'V210';
 };
 
 export declare const FrameFormat: {
@@ -71,11 +75,47 @@ export declare const FrameType: {
     readonly STATUS_CHANGE: 'status_change';
 };
 
+/** Field indices of the header written by captureVideoPacked() */
+export declare const VideoHeader: {
+    readonly XRES: 0;
+    readonly YRES: 1;
+    /** Numeric NDI FourCC code */
+    readonly FOURCC: 2;
+    readonly FRAME_RATE_N: 3;
+    readonly FRAME_RATE_D: 4;
+    /** Numeric NDI frame format (0 interleaved, 1 progressive, 2 field 0, 3 field 1) */
+    readonly FRAME_FORMAT: 5;
+    readonly LINE_STRIDE: 6;
+    readonly TIMECODE: 7;
+    readonly TIMESTAMP: 8;
+    readonly DATA_SIZE: 9;
+    readonly BYTES_WRITTEN: 10;
+    readonly LENGTH: 11;
+};
+
+/** Field indices of the header written by captureAudioPacked() */
+export declare const AudioHeader: {
+    readonly SAMPLE_RATE: 0;
+    readonly NO_CHANNELS: 1;
+    readonly NO_SAMPLES: 2;
+    readonly TIMECODE: 3;
+    readonly TIMESTAMP: 4;
+    readonly DATA_SIZE: 5;
+    readonly SAMPLES_WRITTEN: 6;
+    readonly LENGTH: 7;
+};
+
 // ============================================================================
 // Types
 // ============================================================================
 
 export type FourCCType = typeof FourCC[keyof typeof FourCC];
+
+/**
+ * Conversion targets: the NDI FourCCs plus planar float versions of P216 and
+ * PA16 (Y, U, V and alpha planes of 32-bit floats in 0..1), which are never sent
+ */
+export type ConvertFourCCType = FourCCType | 'F216' | 'FA16';
 export type FrameFormatType = typeof FrameFormat[keyof typeof FrameFormat];
 export type BandwidthType = typeof Bandwidth[keyof typeof Bandwidth];
 export type ColorFormatType = typeof ColorFormat[keyof typeof ColorFormat];
@@ -99,6 +139,31 @@ export interface VideoFrame {
     lineStrideInBytes?: number;
     metadata?: string;
     timestamp?: number;
+    /**
+     * Present on captured frames. Returns the frame memory to the frame pool (or to
+     * NDI for zero-copy frames) immediately and detaches `data`; otherwise this
+     * happens when `data` is garbage collected.
+     */
+    release?(): boolean;
+    /** Downscaled copy of a captured frame when the receiver has a proxy option */
+    proxy?: VideoFrame;
+}
+
+/**
+ * Options for sender.createVideoFormat(): a video frame without data or timecode
+ */
+export type VideoFormatOptions = Omit<VideoFrame, 'data' | 'timecode' | 'timestamp' | 'release' | 'proxy'>;
+
+/**
+ * Prebound video format returned by sender.createVideoFormat()
+ */
+export interface VideoFormat {
+    readonly xres: number;
+    readonly yres: number;
+    readonly fourCC: FourCCType;
+    readonly lineStrideInBytes: number;
+    /** Minimum data Buffer size for a frame of this format */
+    readonly dataSize: number;
 }
 
 export interface AudioFrame {
@@ -110,6 +175,37 @@ export interface AudioFrame {
     channelStrideInBytes?: number;
     metadata?: string;
     timestamp?: number;
+    /**
+     * Present on captured frames. Returns the sample memory to the frame pool
+     * immediately and detaches `data`.
+     */
+    release?(): boolean;
+}
+
+/**
+ * Result of captureVideoInto / captureVideoIntoAsync. The frame data lives in the
+ * buffer passed in, with the same line stride as the source.
+ */
+export interface VideoFrameHeader extends Omit<VideoFrame, 'data' | 'release' | 'proxy'> {
+    /** Bytes needed to hold the whole frame */
+    dataSize: number;
+    /** Bytes actually written (whole lines only) */
+    bytesWritten: number;
+    /** True when the buffer was too small for the whole frame */
+    truncated: boolean;
+}
+
+/**
+ * Result of captureAudioInto / captureAudioIntoAsync. Channels are packed back to
+ * back in the Float32Array passed in, samplesWritten samples each.
+ */
+export interface AudioFrameHeader extends Omit<AudioFrame, 'data'> {
+    /** Bytes needed to hold the whole frame */
+    dataSize: number;
+    /** Samples written per channel */
+    samplesWritten: number;
+    /** True when the array was too small for the whole frame */
+    truncated: boolean;
 }
 
 export interface MetadataFrame {
@@ -130,6 +226,183 @@ export interface CaptureResult {
     metadata?: MetadataFrame;
 }
 
+export interface FramePoolOptions {
+    /** Most bytes kept idle for reuse, 0 disables recycling (default: 256 MiB) */
+    maxBytes?: number;
+}
+
+export interface FramePoolStats {
+    /** Captures served from a recycled buffer */
+    hits: number;
+    /** Captures that needed a fresh allocation */
+    misses: number;
+    /** Returned buffers freed because the pool was full */
+    discarded: number;
+    pooledBytes: number;
+    pooledBlocks: number;
+    /** Bytes currently held by frames in JavaScript */
+    outstandingBytes: number;
+    maxBytes: number;
+}
+
+export interface ThreadPoolOptions {
+    /** Number of threads blocking NDI calls run on (default: 4) */
+    threads?: number;
+}
+
+export interface ThreadPoolStats {
+    threads: number;
+    /** Threads currently inside an NDI call */
+    activeThreads: number;
+    /** Calls waiting for a free thread */
+    queueDepth: number;
+    maxQueueDepth: number;
+    completed: number;
+    /** Average time calls waited for a free thread */
+    averageWaitMs: number;
+    maxWaitMs: number;
+}
+
+export interface ConvertVideoInput {
+    xres: number;
+    yres: number;
+    fourCC: FourCCType;
+    data: Buffer;
+    lineStrideInBytes?: number;
+    lineStride?: number;
+}
+
+export interface ConvertVideoOptions {
+    /** Output line stride, the luma plane's for planar formats (default: packed rows) */
+    lineStrideInBytes?: number;
+    /** Write into this Buffer instead of a pooled one */
+    into?: Buffer;
+    /** Ordered dither instead of rounding when narrowing P216/PA16 (default: false) */
+    dither?: boolean;
+    /** Use the portable scalar kernels instead of SIMD (default: false) */
+    reference?: boolean;
+}
+
+export interface ConvertedVideo {
+    xres: number;
+    yres: number;
+    fourCC: ConvertFourCCType;
+    lineStrideInBytes: number;
+    data: Buffer;
+}
+
+export type ScaleFilterType = 'box' | 'bilinear' | 'lanczos';
+
+export interface ScaleVideoOptions {
+    /** Output width, rounded to an even number of pixels and at most the input width */
+    width?: number;
+    /** Output height, at most the input height; with only one of width and height the other keeps the aspect ratio */
+    height?: number;
+    /** Output size as a fraction of the input, 0 to 1 */
+    scale?: number;
+    /** Resampling filter (default: 'box') */
+    filter?: ScaleFilterType;
+}
+
+export interface ScaledVideo {
+    xres: number;
+    yres: number;
+    fourCC: FourCCType;
+    lineStrideInBytes: number;
+    data: Buffer;
+}
+
+export interface ProxyOptions extends ScaleVideoOptions {
+    /** Deliver the proxy in place of the full frame (default: false) */
+    only?: boolean;
+}
+
+export type CaptureDropPolicy = 'drop-oldest' | 'drop-newest' | 'block';
+
+export interface CaptureThreadOptions {
+    /** Capture timeout per frame (default: 100) */
+    timeout?: number;
+    /** Frames buffered per type, either one depth for all or per type (default: video 4, audio 16, metadata 16) */
+    queueDepth?: number | { video?: number; audio?: number; metadata?: number };
+    /** What to do when a queue is full (default: 'drop-oldest') */
+    dropPolicy?: CaptureDropPolicy;
+    /** Frame types to receive (default: all) */
+    types?: Array<'video' | 'audio' | 'metadata'>;
+}
+
+export interface FrameIteratorOptions {
+    /** Frame types to receive (default: all) */
+    types?: Array<'video' | 'audio' | 'metadata'>;
+    /** Frames buffered before capture pauses (default: 8) */
+    highWaterMark?: number;
+    /** Capture timeout per frame (default: 100) */
+    timeout?: number;
+}
+
+export interface CaptureQueueStats {
+    enqueued: number;
+    dropped: number;
+    /** Deepest the queue has been */
+    highWaterMark: number;
+    depth: number;
+    capacity: number;
+}
+
+export interface CaptureStats {
+    video: CaptureQueueStats;
+    audio: CaptureQueueStats;
+    metadata: CaptureQueueStats;
+}
+
+export interface InterleavedAudioOptions {
+    /** Sample format; inferred from the array type, required for a Buffer */
+    format?: '16s' | '32s' | '32f';
+    /** Number of audio channels (default: 2) */
+    channels?: number;
+    /** Sample rate in Hz (default: 48000) */
+    sampleRate?: number;
+    /** Timecode (synthesized if omitted) */
+    timecode?: number;
+    /** dB above +4 dBU that integer full scale represents (default: 0) */
+    referenceLevel?: number;
+}
+
+export interface AudioFifoOptions {
+    /** Sample rate in Hz (default: 48000) */
+    sampleRate?: number;
+    /** Number of audio channels (default: 2) */
+    noChannels?: number;
+    /** Video frame rate numerator frames are aligned to (default: 30000) */
+    frameRateN?: number;
+    /** Video frame rate denominator (default: 1001) */
+    frameRateD?: number;
+    /** Fixed frame size instead of one video frame's worth of samples */
+    samplesPerFrame?: number;
+}
+
+export interface SendThreadOptions {
+    /** Video frames that can wait in the queue (default: 3) */
+    videoDepth?: number;
+    /** Audio frames that can wait in the queue (default: 16) */
+    audioDepth?: number;
+}
+
+export interface SendStats {
+    videoEnqueued: number;
+    videoSent: number;
+    /** Ticks where no new frame was queued and the previous one was sent again */
+    videoRepeated: number;
+    /** Video frames dropped because the queue was full */
+    videoOverruns: number;
+    audioEnqueued: number;
+    audioSent: number;
+    audioOverruns: number;
+    /** Ticks skipped because a send ran past its slot (always 0 when NDI clocks video) */
+    lateTicks: number;
+    videoDepth: number;
+    audioDepth: number;
+}
+
 // ============================================================================
 // Core Functions
 // ============================================================================
@@ -165,6 +438,49 @@ export declare function version(): string | null;
  */
 export declare function find(timeout?: number, options?: FinderOptions): Promise<NdiSource[]>;
 
+/**
+ * Configure the pool that received frame buffers are recycled through
+ */
+export declare function setFramePoolOptions(options: FramePoolOptions): void;
+
+/**
+ * Get frame pool counters
+ */
+export declare function getFramePoolStats(): FramePoolStats;
+
+/**
+ * Configure the addon's own thread pool for blocking NDI calls
+ */
+export declare function configureThreadPool(options: ThreadPoolOptions): void;
+
+/**
+ * Get NDI thread pool counters
+ */
+export declare function getThreadPoolStats(): ThreadPoolStats;
+
+/**
+ * Convert a video frame between UYVY, BGRA/BGRX/RGBA/RGBX and the planar
+ * I420/YV12/NV12 formats. Planar frames need an even height.
+ */
+export declare function convertVideo(frame: ConvertVideoInput, fourCC: ConvertFourCCType, options?: ConvertVideoOptions): ConvertedVideo;
+
+/**
+ * convertVideo() on the NDI thread pool. frame.data and options.into must
+ * not be modified until the promise settles.
+ */
+export declare function convertVideoAsync(frame: ConvertVideoInput, fourCC: ConvertFourCCType, options?: ConvertVideoOptions): Promise<ConvertedVideo>;
+
+/**
+ * Downscale a UYVY, UYVA, RGB, I420/YV12/NV12 or P216/PA16 frame, keeping
+ * its FourCC
+ */
+export declare function scaleVideo(frame: ConvertVideoInput, options: ScaleVideoOptions): ScaledVideo;
+
+/**
+ * Get the conversion kernel set picked for this CPU
+ */
+export declare function getConvertImplementation(): 'avx2' | 'sse2' | 'neon' | 'scalar';
+
 // ============================================================================
 // Finder
 // ============================================================================
@@ -248,30 +564,65 @@ export interface SenderOptions {
     clockVideo?: boolean;
     /** Clock audio to sample rate (default: true) */
     clockAudio?: boolean;
+    /**
+     * Send from the caller's Buffer instead of a copy (default: false). The
+     * Buffer must not be modified until sendVideoPromise / sendAudioPromise
+     * settles, or until the next sendVideoAsync call.
+     */
+    zeroCopy?: boolean;
 }
 
 export interface SenderEvents {
     tally: (tally: Tally) => void;
+    connections: (connections: number) => void;
 }
 
 export declare class Sender extends EventEmitter {
     constructor(options: SenderOptions);
 
+    /**
+     * Send one video frame through several senders in parallel; the frame is
+     * parsed and pinned once. Leave the data alone until the promise resolves.
+     */
+    static sendVideoMulti(senders: Sender[], frame: VideoFrame): Promise<void>;
+    static sendVideoMulti(senders: Sender[], format: VideoFormat, data: Buffer | Uint8Array, timecode?: number | bigint): Promise<void>;
+
+    /**
+     * Parse the per-stream part of a video frame once, for sendVideo(format, data, timecode)
+     * @param options Frame fields that stay the same from frame to frame
+     */
+    createVideoFormat(options: VideoFormatOptions): VideoFormat;
+
+    /**
+     * Allocate a writable, pooled Buffer for a tightly packed video frame.
+     * sendVideo* sends it without copying and detaches it once sent.
+     * @param fourCC Pixel format (default: 'BGRA')
+     */
+    allocateVideoFrame(xres: number, yres: number, fourCC?: FourCCType): Buffer;
+
     /**
      * Send a video frame
      */
     sendVideo(frame: VideoFrame): void;
+    /**
+     * Send a video frame described by a prebound format; sent straight from data
+     * @param timecode Frame timecode (synthesized by NDI if omitted)
+     */
+    sendVideo(format: VideoFormat, data: Buffer | Uint8Array, timecode?: number | bigint): void;
 
     /**
-     * Send a video frame asynchronously (non-blocking, uses NDI async API)
+     * Send a video frame asynchronously (non-blocking, uses NDI async API).
+     * Returns once the previous frame has been handed off.
      */
     sendVideoAsync(frame: VideoFrame): void;
+    sendVideoAsync(format: VideoFormat, data: Buffer | Uint8Array, timecode?: number | bigint): void;
 
     /**
      * Send a video frame (Promise-based async, runs on background thread)
      * @returns Promise that resolves when the frame is sent
      */
     sendVideoPromise(frame: VideoFrame): Promise<void>;
+    sendVideoPromise(format: VideoFormat, data: Buffer | Uint8Array, timecode?: number | bigint): Promise<void>;
 
     /**
      * Send an audio frame
@@ -284,6 +635,65 @@ export declare class Sender extends EventEmitter {
      */
     sendAudioPromise(frame: AudioFrame): Promise<void>;
 
+    /**
+     * Send interleaved integer or float audio, converted to planar float by NDI
+     */
+    sendAudioInterleaved(samples: Int16Array | Int32Array | Float32Array | Buffer, options?: InterleavedAudioOptions): void;
+
+    /**
+     * Start collecting audio pushed in blocks of any size into whole NDI frames,
+     * sized to one video frame by default
+     */
+    startAudioFifo(options?: AudioFifoOptions): void;
+
+    /**
+     * Append interleaved samples, or one Float32Array per channel
+     * @returns Number of frames completed and sent
+     */
+    pushAudio(samples: Float32Array | Float32Array[]): number;
+
+    /**
+     * Send the samples pending in the FIFO as a shorter frame
+     * @returns False if nothing was pending
+     */
+    flushAudio(): boolean;
+
+    /**
+     * Flush and remove the audio FIFO
+     */
+    stopAudioFifo(): void;
+
+    /**
+     * Start a native thread that sends queued frames at the video frame rate,
+     * repeating the previous frame when none is queued in time. A sender
+     * created with clockVideo paces the sends with NDI's clock instead of
+     * the thread's. Create the sender with clockAudio set to false.
+     */
+    startSendThread(options?: SendThreadOptions): void;
+
+    /**
+     * Stop the send thread, dropping frames still queued
+     */
+    stopSendThread(): void;
+
+    /**
+     * Queue a copy of a video frame for the send thread
+     * @returns False if the queue was full and the frame was dropped
+     */
+    enqueueVideo(frame: VideoFrame): boolean;
+    enqueueVideo(format: VideoFormat, data: Buffer | Uint8Array, timecode?: number | bigint): boolean;
+
+    /**
+     * Queue a copy of an audio frame, sent after the next video frame
+     * @returns False if the queue was full and the frame was dropped
+     */
+    enqueueAudio(frame: AudioFrame): boolean;
+
+    /**
+     * Send thread counters, or null if it was never started
+     */
+    getSendStats(): SendStats | null;
+
     /**
      * Send metadata
      */
@@ -336,13 +746,14 @@ export declare class Sender extends EventEmitter {
     addConnectionMetadata(frame: MetadataFrame): void;
 
     /**
-     * Start polling for tally changes. Emits 'tally' event when tally changes.
-     * @param interval Poll interval in milliseconds (default: 100)
+     * Watch for changes on a native thread. Emits 'tally' when the tally
+     * changes and 'connections' when the receiver count changes.
+     * @param interval Longest a connection count change waits to be noticed, in milliseconds, at least 1 (default: 100)
      */
     startTallyPolling(interval?: number): void;
 
     /**
-     * Stop polling for tally changes
+     * Stop watching for tally and connection changes
      */
     stopTallyPolling(): void;
 
@@ -375,6 +786,26 @@ export interface ReceiverOptions {
     allowVideoFields?: boolean;
     /** Receiver name */
     name?: string;
+    /**
+     * Hand NDI's video memory to JavaScript without copying (default: false).
+     * Frames hold on to NDI's internal buffers until released, so call
+     * `frame.release()` as soon as the pixels are no longer needed.
+     */
+    zeroCopy?: boolean;
+    /**
+     * Convert captured video to this FourCC on the capture thread. UYVY,
+     * BGRA/BGRX/RGBA/RGBX and I420/YV12/NV12 convert to one another, except
+     * RGB to RGB, and P216 also packs to V210; other frames pass through.
+     */
+    convertTo?: ConvertFourCCType;
+    /** Ordered dither instead of rounding when convertTo narrows P216/PA16 (default: false) */
+    dither?: boolean;
+    /**
+     * Downscale each captured video frame on the capture thread and attach
+     * it as `frame.proxy`, or with `only: true` deliver it instead of the
+     * full frame. convertTo applies to the proxy as well.
+     */
+    proxy?: ProxyOptions;
 }
 
 export interface ReceiverEvents {
@@ -411,6 +842,40 @@ export declare class Receiver extends EventEmitter {
      */
     captureAudio(timeout?: number): AudioFrame | null;
 
+    /**
+     * Capture a video frame into a caller-owned buffer
+     * @param buffer Destination for the frame data
+     * @param timeout Timeout in milliseconds (default: 1000)
+     */
+    captureVideoInto(buffer: Buffer | Uint8Array, timeout?: number): VideoFrameHeader | null;
+
+    /**
+     * Capture an audio frame into a caller-owned Float32Array
+     * @param buffer Destination for the planar samples
+     * @param timeout Timeout in milliseconds (default: 1000)
+     */
+    captureAudioInto(buffer: Float32Array, timeout?: number): AudioFrameHeader | null;
+
+    /**
+     * Capture a video frame into your own buffer and write its header into a reusable
+     * array (see VideoHeader for field indices). No object is created per frame.
+     * @param header At least VideoHeader.LENGTH elements; BigInt64Array keeps timecodes exact
+     * @param buffer Destination for the frame data
+     * @param timeout Timeout in milliseconds (default: 1000)
+     * @returns True if a frame was captured
+     */
+    captureVideoPacked(header: BigInt64Array | Float64Array, buffer: Buffer | Uint8Array, timeout?: number): boolean;
+
+    /**
+     * Capture an audio frame into your own Float32Array and write its header into a
+     * reusable array (see AudioHeader for field indices). No object is created per frame.
+     * @param header At least AudioHeader.LENGTH elements; BigInt64Array keeps timecodes exact
+     * @param buffer Destination for the planar samples, channels packed back to back
+     * @param timeout Timeout in milliseconds (default: 1000)
+     * @returns True if a frame was captured
+     */
+    captureAudioPacked(header: BigInt64Array | Float64Array, buffer: Float32Array, timeout?: number): boolean;
+
     /**
      * Capture a frame asynchronously (video, audio, or metadata) - non-blocking
      * @param timeout Timeout in milliseconds (default: 1000)
@@ -432,6 +897,22 @@ export declare class Receiver extends EventEmitter {
      */
     captureAudioAsync(timeout?: number): Promise<AudioFrame | null>;
 
+    /**
+     * Capture a video frame into a caller-owned buffer asynchronously - non-blocking.
+     * Do not touch the buffer until the promise settles.
+     * @param buffer Destination for the frame data
+     * @param timeout Timeout in milliseconds (default: 1000)
+     */
+    captureVideoIntoAsync(buffer: Buffer | Uint8Array, timeout?: number): Promise<VideoFrameHeader | null>;
+
+    /**
+     * Capture an audio frame into a caller-owned Float32Array asynchronously - non-blocking.
+     * Do not touch the array until the promise settles.
+     * @param buffer Destination for the planar samples
+     * @param timeout Timeout in milliseconds (default: 1000)
+     */
+    captureAudioIntoAsync(buffer: Float32Array, timeout?: number): Promise<AudioFrameHeader | null>;
+
     /**
      * Set tally information
      */
@@ -545,10 +1026,61 @@ export declare class Receiver extends EventEmitter {
     startCapture(timeout?: number, useAsync?: boolean): void;
 
     /**
-     * Stop continuous capture
+     * Start continuous capture on a dedicated native thread. Emits the same events as
+     * startCapture() without a threadpool round-trip per frame.
+     * @param options Capture timeout per frame (default: 100), or capture thread options
+     */
+    startCaptureThread(options?: number | CaptureThreadOptions): void;
+
+    /**
+     * Iterate over captured frames with for await. Capture pauses while
+     * highWaterMark frames are waiting; leaving the loop stops capture.
+     * @param options Iterator options
+     */
+    frames(options?: FrameIteratorOptions): AsyncGenerator<CaptureResult, void, undefined>;
+
+    /**
+     * Get queue statistics for the capture thread
+     * @returns Per-type queue counters, or null if no capture thread was started
+     */
+    getCaptureStats(): CaptureStats | null;
+
+    /**
+     * Pause a capture thread started with startCaptureThread()
+     * @returns False if no capture thread is running
+     */
+    pauseCapture(): boolean;
+
+    /**
+     * Resume a paused capture thread
+     * @returns False if no capture thread is running
+     */
+    resumeCapture(): boolean;
+
+    /**
+     * Stop continuous capture (either mode)
      */
     stopCapture(): void;
 
+    /**
+     * Keep only the most recent video frame, captured on a native thread.
+     * Audio and metadata are not received in this mode.
+     * @param timeout Capture timeout per frame (default: 100)
+     */
+    startLatestVideo(timeout?: number): void;
+
+    /**
+     * Get the most recent video frame without waiting. The same object is
+     * returned until a newer frame arrives.
+     * @returns Video frame, or null if none has arrived yet
+     */
+    getLatestVideo(): VideoFrame | null;
+
+    /**
+     * Stop latest-frame capture
+     */
+    stopLatestVideo(): void;
+
     /**
      * Check if receiver is valid
      */
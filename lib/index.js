@@ -50,6 +50,8 @@ const FrameFormat = ndiAddon.FrameFormat;
 const Bandwidth = ndiAddon.Bandwidth;
 const ColorFormat = ndiAddon.ColorFormat;
 const FrameType = ndiAddon.FrameType;
+const VideoHeader = ndiAddon.VideoHeader;
+const AudioHeader = ndiAddon.AudioHeader;
 
 /**
  * Initialize the NDI library. Must be called before using any other functions.
@@ -82,6 +84,93 @@ function version() {
     return ndiAddon.version();
 }
 
+/**
+ * Configure the pool that received frame buffers are recycled through
+ * @param {Object} options - Pool options
+ * @param {number} [options.maxBytes] - Most bytes kept idle for reuse (0 disables recycling)
+ */
+function setFramePoolOptions(options) {
+    ndiAddon.setFramePoolOptions(options);
+}
+
+/**
+ * Get frame pool counters
+ * @returns {{hits: number, misses: number, discarded: number, pooledBytes: number, pooledBlocks: number, outstandingBytes: number, maxBytes: number}}
+ */
+function getFramePoolStats() {
+    return ndiAddon.getFramePoolStats();
+}
+
+/**
+ * Configure the addon's own thread pool that blocking NDI calls (async capture,
+ * send, tally and source discovery) run on, separate from UV_THREADPOOL_SIZE
+ * @param {Object} options - Pool options
+ * @param {number} [options.threads] - Number of threads (default: 4)
+ */
+function configureThreadPool(options) {
+    ndiAddon.configureThreadPool(options);
+}
+
+/**
+ * Get NDI thread pool counters
+ * @returns {{threads: number, activeThreads: number, queueDepth: number, maxQueueDepth: number, completed: number, averageWaitMs: number, maxWaitMs: number}}
+ */
+function getThreadPoolStats() {
+    return ndiAddon.getThreadPoolStats();
+}
+
+/**
+ * Convert a video frame between UYVY, BGRA/BGRX/RGBA/RGBX and the planar I420/YV12/NV12 formats,
+ * narrow 16-bit P216/PA16 to any of them or unpack it to planar float (F216/FA16), or pack
+ * P216 to 10-bit V210 and back
+ * @param {Object} frame - Video frame with xres, yres, fourCC, data and a line stride
+ * @param {string} fourCC - Target FourCC
+ * @param {Object} [options] - Conversion options
+ * @param {number} [options.lineStrideInBytes] - Output line stride, the luma plane's for planar formats (default: packed rows)
+ * @param {Buffer} [options.into] - Write into this Buffer instead of a pooled one
+ * @param {boolean} [options.dither=false] - Ordered dither instead of rounding when narrowing 16-bit video
+ * @param {boolean} [options.reference=false] - Use the portable scalar kernels instead of SIMD
+ * @returns {{xres: number, yres: number, fourCC: string, lineStrideInBytes: number, data: Buffer}}
+ */
+function convertVideo(frame, fourCC, options) {
+    return ndiAddon.convertVideo(frame, fourCC, options);
+}
+
+/**
+ * Convert a video frame like convertVideo(), on the NDI thread pool instead of the calling thread.
+ * frame.data and options.into must not be modified until the promise settles.
+ * @param {Object} frame - Video frame with xres, yres, fourCC, data and a line stride
+ * @param {string} fourCC - Target FourCC
+ * @param {Object} [options] - Same options as convertVideo()
+ * @returns {Promise<{xres: number, yres: number, fourCC: string, lineStrideInBytes: number, data: Buffer}>}
+ */
+function convertVideoAsync(frame, fourCC, options) {
+    return ndiAddon.convertVideoAsync(frame, fourCC, options);
+}
+
+/**
+ * Downscale a video frame, keeping its FourCC. Works for UYVY, UYVA, BGRA/BGRX/RGBA/RGBX,
+ * I420/YV12/NV12 and P216/PA16
+ * @param {Object} frame - Video frame with xres, yres, fourCC, data and a line stride
+ * @param {Object} options - Target size: width and/or height (the other follows the aspect ratio) or scale
+ * @param {number} [options.width] - Output width, rounded to an even number of pixels and at most the input width
+ * @param {number} [options.height] - Output height, at most the input height
+ * @param {number} [options.scale] - Fraction of the input size, 0 to 1
+ * @param {string} [options.filter='box'] - 'box', 'bilinear' or 'lanczos'
+ * @returns {{xres: number, yres: number, fourCC: string, lineStrideInBytes: number, data: Buffer}}
+ */
+function scaleVideo(frame, options) {
+    return ndiAddon.scaleVideo(frame, options);
+}
+
+/**
+ * Get the conversion kernel set picked for this CPU
+ * @returns {string} 'avx2', 'sse2', 'neon' or 'scalar'
+ */
+function getConvertImplementation() {
+    return ndiAddon.getConvertImplementation();
+}
+
 /**
  * NDI Finder - Discovers NDI sources on the network
  */
@@ -196,6 +285,9 @@ class Sender extends EventEmitter {
      * @param {string} [options.groups] - Comma-separated list of groups
      * @param {boolean} [options.clockVideo=true] - Clock video to frame rate
      * @param {boolean} [options.clockAudio=true] - Clock audio to sample rate
+     * @param {boolean} [options.zeroCopy=false] - Send from the caller's Buffer instead of a copy.
+     *   sendVideoPromise / sendAudioPromise hold the Buffer until the promise settles and
+     *   sendVideoAsync until the next sendVideoAsync call; do not modify it before then.
      */
     constructor(options) {
         super();
@@ -206,40 +298,85 @@ class Sender extends EventEmitter {
         
         this._sender = new ndiAddon.NdiSender(options);
         this._tallyPolling = false;
-        this._tallyInterval = null;
     }
 
     /**
-     * Send a video frame
-     * @param {Object} frame - Video frame object
+     * Send the same video frame through several senders, e.g. one program
+     * feed published under different names or groups. The frame is parsed
+     * and pinned once and the senders run in parallel on native threads.
+     * @param {Sender[]} senders - Senders to send through, each at most once
+     * @param {Object} frame - Video frame object or format (same as sendVideo)
+     * @param {Buffer} [data] - Pixel data, when frame is a format
+     * @param {number|bigint} [timecode] - Timecode, when frame is a format
+     * @returns {Promise<void>} Resolves once every sender has sent the frame; leave the data alone until then
+     */
+    static sendVideoMulti(senders, frame, data, timecode) {
+        return ndiAddon.NdiSender.sendVideoMulti(senders.map((sender) => sender._sender), frame, data, timecode);
+    }
+
+    /**
+     * Parse the per-stream part of a video frame once. Pass the result to
+     * sendVideo(format, data, timecode) to skip option parsing on every frame.
+     * @param {Object} options - Same fields as a sendVideo() frame object, without data
+     * @returns {Object} Native format handle with xres, yres, fourCC, lineStrideInBytes and dataSize
+     */
+    createVideoFormat(options) {
+        return this._sender.createVideoFormat(options);
+    }
+
+    /**
+     * Allocate a writable, pooled Buffer to render a video frame into. The
+     * sendVideo* methods send it without copying and then recycle it: the
+     * Buffer is detached once the send completes, so allocate one per frame.
+     * @param {number} xres - Width in pixels
+     * @param {number} yres - Height in pixels
+     * @param {string} [fourCC='BGRA'] - Pixel format; lines are tightly packed
+     * @returns {Buffer} Frame data of the size the format needs
+     */
+    allocateVideoFrame(xres, yres, fourCC) {
+        return this._sender.allocateVideoFrame(xres, yres, fourCC);
+    }
+
+    /**
+     * Send a video frame, either as a frame object or as (format, data, timecode)
+     * @param {Object} frame - Video frame object, or a format from createVideoFormat()
      * @param {number} frame.xres - Width in pixels
      * @param {number} frame.yres - Height in pixels
-     * @param {string} [frame.fourCC='BGRA'] - Pixel format (BGRA, RGBA, UYVY, etc.)
+     * @param {string} [frame.fourCC='BGRA'] - Pixel format (BGRA, RGBA, UYVY, etc.); V210 is
+     *   unpacked to P216 natively before it is sent
      * @param {number} [frame.frameRateN=30000] - Frame rate numerator
      * @param {number} [frame.frameRateD=1001] - Frame rate denominator
      * @param {string} [frame.frameFormatType='progressive'] - Frame format type
      * @param {Buffer} frame.data - Raw pixel data
      * @param {number} [frame.lineStrideInBytes] - Bytes per line (auto-calculated if not provided)
+     * @param {Buffer} [data] - Pixel data, when frame is a format
+     * @param {number|bigint} [timecode] - Timecode, when frame is a format (synthesized if omitted)
      */
-    sendVideo(frame) {
-        this._sender.sendVideo(frame);
+    sendVideo(frame, data, timecode) {
+        this._sender.sendVideo(frame, data, timecode);
     }
 
     /**
-     * Send a video frame asynchronously (non-blocking, uses NDI async API)
-     * @param {Object} frame - Video frame object (same as sendVideo)
+     * Send a video frame asynchronously (non-blocking, uses NDI async API).
+     * Returns once the previous frame has been handed off, so the next frame
+     * can be prepared while this one is encoded.
+     * @param {Object} frame - Video frame object or format (same as sendVideo)
+     * @param {Buffer} [data] - Pixel data, when frame is a format
+     * @param {number|bigint} [timecode] - Timecode, when frame is a format
      */
-    sendVideoAsync(frame) {
-        this._sender.sendVideoAsync(frame);
+    sendVideoAsync(frame, data, timecode) {
+        this._sender.sendVideoAsync(frame, data, timecode);
     }
 
     /**
      * Send a video frame (Promise-based async, runs on background thread)
-     * @param {Object} frame - Video frame object (same as sendVideo)
+     * @param {Object} frame - Video frame object or format (same as sendVideo)
+     * @param {Buffer} [data] - Pixel data, when frame is a format
+     * @param {number|bigint} [timecode] - Timecode, when frame is a format
      * @returns {Promise<void>}
      */
-    sendVideoPromise(frame) {
-        return this._sender.sendVideoPromise(frame);
+    sendVideoPromise(frame, data, timecode) {
+        return this._sender.sendVideoPromise(frame, data, timecode);
     }
 
     /**
@@ -263,6 +400,110 @@ class Sender extends EventEmitter {
         return this._sender.sendAudioPromise(frame);
     }
 
+    /**
+     * Send interleaved integer or float audio; NDI converts it to planar float
+     * while sending, so no deinterleaving is needed in JavaScript
+     * @param {Int16Array|Int32Array|Float32Array|Buffer} samples - Interleaved samples
+     * @param {Object} [options] - Audio options
+     * @param {string} [options.format] - '16s', '32s' or '32f'; inferred from the array type, required for a Buffer
+     * @param {number} [options.channels=2] - Number of audio channels
+     * @param {number} [options.sampleRate=48000] - Sample rate in Hz
+     * @param {number} [options.timecode] - Timecode (synthesized if omitted)
+     * @param {number} [options.referenceLevel=0] - dB above +4 dBU that integer full scale represents
+     */
+    sendAudioInterleaved(samples, options) {
+        this._sender.sendAudioInterleaved(samples, options);
+    }
+
+    /**
+     * Start collecting audio pushed in blocks of any size into whole NDI
+     * frames. Frames are sent as they fill, through the send thread if it is
+     * running. Pending samples of a previous FIFO are sent first.
+     * @param {Object} [options] - FIFO options
+     * @param {number} [options.sampleRate=48000] - Sample rate in Hz
+     * @param {number} [options.noChannels=2] - Number of audio channels
+     * @param {number} [options.frameRateN=30000] - Video frame rate numerator frames are aligned to
+     * @param {number} [options.frameRateD=1001] - Video frame rate denominator
+     * @param {number} [options.samplesPerFrame] - Fixed frame size instead of one video frame's worth
+     */
+    startAudioFifo(options) {
+        this._sender.startAudioFifo(options);
+    }
+
+    /**
+     * Append audio to the FIFO
+     * @param {Float32Array|Float32Array[]} samples - Interleaved samples, or one array per channel
+     * @returns {number} Number of frames completed and sent
+     */
+    pushAudio(samples) {
+        return this._sender.pushAudio(samples);
+    }
+
+    /**
+     * Send the samples pending in the FIFO as a shorter frame
+     * @returns {boolean} False if nothing was pending
+     */
+    flushAudio() {
+        return this._sender.flushAudio();
+    }
+
+    /**
+     * Flush and remove the audio FIFO
+     */
+    stopAudioFifo() {
+        this._sender.stopAudioFifo();
+    }
+
+    /**
+     * Start a native thread that sends queued frames at the video frame rate,
+     * independent of event-loop jitter. The previous frame is repeated when
+     * none is queued in time. With clockVideo set to false the thread keeps
+     * its own clock; otherwise it leaves pacing to NDI's. Create the sender
+     * with clockAudio set to false.
+     * @param {Object} [options] - Send thread options
+     * @param {number} [options.videoDepth=3] - Video frames that can wait in the queue
+     * @param {number} [options.audioDepth=16] - Audio frames that can wait in the queue
+     */
+    startSendThread(options) {
+        this._sender.startSendThread(options);
+    }
+
+    /**
+     * Stop the send thread, dropping frames still queued
+     */
+    stopSendThread() {
+        this._sender.stopSendThread();
+    }
+
+    /**
+     * Queue a video frame for the send thread. The data is copied, so the
+     * Buffer can be reused as soon as this returns.
+     * @param {Object} frame - Video frame object or format (same as sendVideo)
+     * @param {Buffer} [data] - Pixel data, when frame is a format
+     * @param {number|bigint} [timecode] - Timecode, when frame is a format
+     * @returns {boolean} False if the queue was full and the frame was dropped
+     */
+    enqueueVideo(frame, data, timecode) {
+        return this._sender.enqueueVideo(frame, data, timecode);
+    }
+
+    /**
+     * Queue an audio frame, sent by the send thread after the next video frame
+     * @param {Object} frame - Audio frame object (same as sendAudio)
+     * @returns {boolean} False if the queue was full and the frame was dropped
+     */
+    enqueueAudio(frame) {
+        return this._sender.enqueueAudio(frame);
+    }
+
+    /**
+     * Get send thread counters
+     * @returns {Object|null} Counters, or null if the send thread was never started
+     */
+    getSendStats() {
+        return this._sender.getSendStats();
+    }
+
     /**
      * Send metadata
      * @param {Object} frame - Metadata frame
@@ -341,34 +582,33 @@ class Sender extends EventEmitter {
     }
 
     /**
-     * Start polling for tally changes. Emits 'tally' event when tally changes.
-     * @param {number} [interval=100] - Poll interval in milliseconds
+     * Watch for tally and connection changes on a native thread. Emits 'tally'
+     * as soon as NDI reports a tally change and 'connections' with the new
+     * receiver count; nothing runs on the event loop while neither changes.
+     * @param {number} [interval=100] - Longest a connection count change waits to be noticed, in milliseconds (at least 1)
      */
     startTallyPolling(interval = 100) {
         if (this._tallyPolling) return;
         
-        this._tallyPolling = true;
-        let lastTally = JSON.stringify(this.getTally());
-        
-        this._tallyInterval = setInterval(() => {
-            const tally = this.getTally();
-            const tallyJson = JSON.stringify(tally);
-            
-            if (tallyJson !== lastTally) {
-                lastTally = tallyJson;
-                this.emit('tally', tally);
+        this._sender.startWatcher((change) => {
+            if (change.tally) {
+                this.emit('tally', change.tally);
+            }
+            if (change.connections !== null) {
+                this.emit('connections', change.connections);
             }
         }, interval);
+        
+        this._tallyPolling = true;
     }
 
     /**
-     * Stop polling for tally changes
+     * Stop watching for tally and connection changes
      */
     stopTallyPolling() {
-        if (this._tallyInterval) {
-            clearInterval(this._tallyInterval);
-            this._tallyInterval = null;
-        }
+        if (!this._tallyPolling) return;
+        
+        this._sender.stopWatcher();
         this._tallyPolling = false;
     }
 
@@ -403,12 +643,27 @@ class Receiver extends EventEmitter {
      * @param {string} [options.bandwidth='highest'] - Bandwidth mode
      * @param {boolean} [options.allowVideoFields=true] - Allow video fields
      * @param {string} [options.name] - Receiver name
+     * @param {boolean} [options.zeroCopy=false] - Hand NDI's video memory to JS without copying.
+     *   The frame is returned to NDI when its data Buffer is garbage collected or frame.release() is called
+     * @param {string} [options.convertTo] - Convert video to this FourCC natively as it is captured
+     *   (UYVY, BGRA/BGRX/RGBA/RGBX, I420/YV12/NV12, F216/FA16 from P216/PA16 or V210 from P216); takes precedence over
+     *   zeroCopy for frames it converts
+     * @param {boolean} [options.dither=false] - Dither instead of round when convertTo narrows 16-bit video
+     * @param {Object} [options.proxy] - Also deliver a downscaled copy of each video frame as frame.proxy,
+     *   scaled on the capture thread before convertTo is applied
+     * @param {number} [options.proxy.width] - Proxy width; height follows the aspect ratio unless given
+     * @param {number} [options.proxy.height] - Proxy height
+     * @param {number} [options.proxy.scale] - Proxy size as a fraction of the frame, 0 to 1
+     * @param {string} [options.proxy.filter='box'] - 'box', 'bilinear' or 'lanczos'
+     * @param {boolean} [options.proxy.only=false] - Deliver the proxy in place of the full frame
      */
     constructor(options = {}) {
         super();
         this._receiver = new ndiAddon.NdiReceiver(options);
         this._capturing = false;
         this._captureLoop = null;
+        this._captureThread = false;
+        this._latestVideo = false;
     }
 
     /**
@@ -448,6 +703,55 @@ class Receiver extends EventEmitter {
         return this._receiver.captureAudio(timeout);
     }
 
+    /**
+     * Capture a video frame into a caller-owned buffer instead of allocating one.
+     * Whole lines are written; if the buffer is too small the frame is truncated.
+     * @param {Buffer|Uint8Array} buffer - Destination for the frame data
+     * @param {number} [timeout=1000] - Timeout in milliseconds
+     * @returns {Object|null} Frame header with dataSize, bytesWritten and truncated, or null if timeout
+     */
+    captureVideoInto(buffer, timeout = 1000) {
+        return this._receiver.captureVideoInto(buffer, timeout);
+    }
+
+    /**
+     * Capture an audio frame into a caller-owned Float32Array instead of allocating one.
+     * Channels are packed back to back; if the array is too small each channel keeps
+     * only its leading samples.
+     * @param {Float32Array} buffer - Destination for the planar samples
+     * @param {number} [timeout=1000] - Timeout in milliseconds
+     * @returns {Object|null} Frame header with dataSize, samplesWritten and truncated, or null if timeout
+     */
+    captureAudioInto(buffer, timeout = 1000) {
+        return this._receiver.captureAudioInto(buffer, timeout);
+    }
+
+    /**
+     * Capture a video frame into a caller-owned buffer and write its header into a
+     * reusable array, so no object is created per frame. Read fields with the
+     * VideoHeader indices; a BigInt64Array keeps timecodes exact.
+     * @param {BigInt64Array|Float64Array} header - At least VideoHeader.LENGTH elements
+     * @param {Buffer|Uint8Array} buffer - Destination for the frame data
+     * @param {number} [timeout=1000] - Timeout in milliseconds
+     * @returns {boolean} True if a frame was captured
+     */
+    captureVideoPacked(header, buffer, timeout = 1000) {
+        return this._receiver.captureVideoPacked(header, buffer, timeout);
+    }
+
+    /**
+     * Capture an audio frame into a caller-owned Float32Array and write its header
+     * into a reusable array, so no object is created per frame. Read fields with
+     * the AudioHeader indices. Channels are packed back to back.
+     * @param {BigInt64Array|Float64Array} header - At least AudioHeader.LENGTH elements
+     * @param {Float32Array} buffer - Destination for the planar samples
+     * @param {number} [timeout=1000] - Timeout in milliseconds
+     * @returns {boolean} True if a frame was captured
+     */
+    captureAudioPacked(header, buffer, timeout = 1000) {
+        return this._receiver.captureAudioPacked(header, buffer, timeout);
+    }
+
     /**
      * Capture a frame asynchronously (video, audio, or metadata) - non-blocking
      * @param {number} [timeout=1000] - Timeout in milliseconds
@@ -475,6 +779,28 @@ class Receiver extends EventEmitter {
         return this._receiver.captureAudioAsync(timeout);
     }
 
+    /**
+     * Capture a video frame into a caller-owned buffer asynchronously - non-blocking.
+     * The buffer is written from a worker thread; leave it alone until the promise settles.
+     * @param {Buffer|Uint8Array} buffer - Destination for the frame data
+     * @param {number} [timeout=1000] - Timeout in milliseconds
+     * @returns {Promise<Object|null>} Frame header or null if timeout
+     */
+    captureVideoIntoAsync(buffer, timeout = 1000) {
+        return this._receiver.captureVideoIntoAsync(buffer, timeout);
+    }
+
+    /**
+     * Capture an audio frame into a caller-owned Float32Array asynchronously - non-blocking.
+     * The array is written from a worker thread; leave it alone until the promise settles.
+     * @param {Float32Array} buffer - Destination for the planar samples
+     * @param {number} [timeout=1000] - Timeout in milliseconds
+     * @returns {Promise<Object|null>} Frame header or null if timeout
+     */
+    captureAudioIntoAsync(buffer, timeout = 1000) {
+        return this._receiver.captureAudioIntoAsync(buffer, timeout);
+    }
+
     /**
      * Set tally information
      * @param {{onProgram: boolean, onPreview: boolean}} tally
@@ -652,23 +978,7 @@ class Receiver extends EventEmitter {
                         const result = await this.captureAsync(timeout);
                         
                         if (result && this._capturing) {
-                            switch (result.type) {
-                                case 'video':
-                                    this.emit('video', result.video);
-                                    break;
-                                case 'audio':
-                                    this.emit('audio', result.audio);
-                                    break;
-                                case 'metadata':
-                                    this.emit('metadata', result.metadata);
-                                    break;
-                                case 'status_change':
-                                    this.emit('status_change');
-                                    break;
-                                case 'error':
-                                    this.emit('error', new Error('NDI receive error'));
-                                    break;
-                            }
+                            this._emitCaptureResult(result);
                         }
                     } catch (err) {
                         if (this._capturing) {
@@ -687,23 +997,7 @@ class Receiver extends EventEmitter {
                 const result = this.capture(timeout);
                 
                 if (result) {
-                    switch (result.type) {
-                        case 'video':
-                            this.emit('video', result.video);
-                            break;
-                        case 'audio':
-                            this.emit('audio', result.audio);
-                            break;
-                        case 'metadata':
-                            this.emit('metadata', result.metadata);
-                            break;
-                        case 'status_change':
-                            this.emit('status_change');
-                            break;
-                        case 'error':
-                            this.emit('error', new Error('NDI receive error'));
-                            break;
-                    }
+                    this._emitCaptureResult(result);
                 }
                 
                 // Use setImmediate for non-blocking capture loop
@@ -716,6 +1010,83 @@ class Receiver extends EventEmitter {
         }
     }
 
+    /**
+     * Start continuous capture on a dedicated native thread. Emits the same events
+     * as startCapture() without a threadpool round-trip or promise per frame, and
+     * keeps receiving while the event loop is busy.
+     * @param {number|Object} [options] - Capture timeout per frame, or options
+     * @param {number} [options.timeout=100] - Capture timeout per frame
+     * @param {number|Object} [options.queueDepth] - Frames buffered per type ({ video: 4, audio: 16, metadata: 16 })
+     * @param {string} [options.dropPolicy='drop-oldest'] - 'drop-oldest', 'drop-newest' or 'block' when a queue is full
+     * @param {string[]} [options.types] - Frame types to receive ('video', 'audio', 'metadata'), all by default
+     */
+    startCaptureThread(options = {}) {
+        if (this._capturing) return;
+        
+        this._receiver.startCaptureThread((result) => {
+            if (this._capturing) {
+                this._emitCaptureResult(result);
+            }
+        }, options);
+        
+        this._capturing = true;
+        this._captureThread = true;
+    }
+
+    /**
+     * Iterate over captured frames with for await. Frames wait in a native
+     * queue; once highWaterMark frames are waiting, capture stops until the
+     * loop catches up. Leaving the loop stops capture.
+     * @param {Object} [options] - Iterator options
+     * @param {string[]} [options.types] - Frame types to receive ('video', 'audio', 'metadata'), all by default
+     * @param {number} [options.highWaterMark=8] - Frames buffered before capture pauses
+     * @param {number} [options.timeout=100] - Capture timeout per frame
+     * @returns {AsyncGenerator<Object>} Frames shaped like captureAsync() results
+     */
+    async *frames(options = {}) {
+        if (this._capturing) {
+            throw new Error('Capture is already running');
+        }
+        
+        this._receiver.startFrameQueue(options);
+        this._capturing = true;
+        this._captureThread = true;
+        
+        try {
+            while (true) {
+                const frame = await this._receiver.nextFrame();
+                if (!frame) return;
+                yield frame;
+            }
+        } finally {
+            this.stopCapture();
+        }
+    }
+
+    /**
+     * Get queue statistics for the capture thread
+     * @returns {Object|null} Per-type { enqueued, dropped, highWaterMark, depth, capacity }, or null if never started
+     */
+    getCaptureStats() {
+        return this._receiver.getCaptureStats();
+    }
+
+    /**
+     * Pause a capture thread started with startCaptureThread()
+     * @returns {boolean} False if no capture thread is running
+     */
+    pauseCapture() {
+        return this._receiver.pauseCaptureThread();
+    }
+
+    /**
+     * Resume a paused capture thread
+     * @returns {boolean} False if no capture thread is running
+     */
+    resumeCapture() {
+        return this._receiver.resumeCaptureThread();
+    }
+
     /**
      * Stop continuous capture
      */
@@ -725,6 +1096,74 @@ class Receiver extends EventEmitter {
             clearImmediate(this._captureLoop);
             this._captureLoop = null;
         }
+        if (this._captureThread) {
+            this._receiver.stopCaptureThread();
+            this._captureThread = false;
+        }
+        if (this._latestVideo) {
+            this._receiver.stopLatestVideo();
+            this._latestVideo = false;
+        }
+    }
+
+    /**
+     * Keep only the most recent video frame, captured on a native thread.
+     * Read it with getLatestVideo(); audio and metadata are not received
+     * in this mode, and other capture methods throw until it is stopped.
+     * @param {number} [timeout=100] - Capture timeout per frame
+     */
+    startLatestVideo(timeout = 100) {
+        if (this._capturing) {
+            throw new Error('Capture is already running');
+        }
+        
+        this._receiver.startLatestVideo(timeout);
+        this._capturing = true;
+        this._latestVideo = true;
+    }
+
+    /**
+     * Get the most recent video frame without waiting. The same object is
+     * returned until a newer frame arrives.
+     * @returns {Object|null} Video frame, or null if none has arrived yet
+     */
+    getLatestVideo() {
+        return this._receiver.getLatestVideo();
+    }
+
+    /**
+     * Stop latest-frame capture
+     */
+    stopLatestVideo() {
+        this._receiver.stopLatestVideo();
+        if (this._latestVideo) {
+            this._capturing = false;
+            this._latestVideo = false;
+        }
+    }
+
+    /**
+     * Emit the event matching a capture result
+     * @private
+     */
+    _emitCaptureResult(result) {
+        switch (result.type) {
+            case 'video':
+                this.emit('video', result.video);
+                break;
+            case 'audio':
+                this.emit('audio', result.audio);
+                break;
+            case 'metadata':
+                this.emit('metadata', result.metadata);
+                break;
+            case 'status_change':
+                this.emit('status_change');
+                break;
+            case 'error':
+                this.emit('error', new Error('NDI receive error'));
+                break;
+        }
     }
 
     /**
@@ -771,6 +1210,14 @@ module.exports = {
     isInitialized,
     version,
     find,
+    setFramePoolOptions,
+    getFramePoolStats,
+    configureThreadPool,
+    getThreadPoolStats,
+    convertVideo,
+    convertVideoAsync,
+    scaleVideo,
+    getConvertImplementation,
     
     // Classes
     Finder,
@@ -783,6 +1230,8 @@ module.exports = {
     Bandwidth,
     ColorFormat,
     FrameType,
+    VideoHeader,
+    AudioHeader,
     
     // Native addon (for advanced use)
     native: ndiAddon
@@ -25,6 +25,12 @@
 #include "ndi_finder.h"
 #include "ndi_sender.h"
 #include "ndi_receiver.h"
+#include "ndi_convert.h"
+#include "ndi_frame_pool.h"
+#include "ndi_executor.h"
+#include "ndi_scale.h"
+#include "ndi_utils.h"
+#include "ndi_video_format.h"
 
 // Global initialization state
 static bool g_ndi_initialized = false;
@@ -85,6 +91,17 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     NdiFinder::Init(env, exports);
     NdiSender::Init(env, exports);
     NdiReceiver::Init(env, exports);
+    NdiVideoFormat::Init(env, exports);
+    
+    // Receive buffer pool and NDI thread pool configuration
+    NdiFramePool::Init(env, exports);
+    NdiExecutor::Init(env, exports);
+    
+    // Pixel format conversion, dispatched to the best kernels for this CPU
+    NdiConvert::Init(env, exports);
+    
+    // Downscaling for proxy streams
+    NdiScale::Init(env, exports);
     
     // Export constants
     Napi::Object fourCC = Napi::Object::New(env);
@@ -93,10 +110,13 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     fourCC.Set("BGRX", Napi::String::New(env, "BGRX"));
     fourCC.Set("RGBA", Napi::String::New(env, "RGBA"));
     fourCC.Set("RGBX", Napi::String::New(env, "RGBX"));
+    fourCC.Set("UYVA", Napi::String::New(env, "UYVA"));
     fourCC.Set("I420", Napi::String::New(env, "I420"));
+    fourCC.Set("YV12", Napi::String::New(env, "YV12"));
     fourCC.Set("NV12", Napi::String::New(env, "NV12"));
     fourCC.Set("P216", Napi::String::New(env, "P216"));
     fourCC.Set("PA16", Napi::String::New(env, "PA16"));
+    fourCC.Set("V210", Napi::String::New(env, "V210"));
     exports.Set("FourCC", fourCC);
     
     Napi::Object frameFormat = Napi::Object::New(env);
@@ -131,6 +151,33 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     frameType.Set("STATUS_CHANGE", Napi::String::New(env, "status_change"));
     exports.Set("FrameType", frameType);
     
+    // Field indices for captureVideoPacked() / captureAudioPacked() headers
+    Napi::Object videoHeader = Napi::Object::New(env);
+    videoHeader.Set("XRES", Napi::Number::New(env, NdiUtils::VideoHeaderXres));
+    videoHeader.Set("YRES", Napi::Number::New(env, NdiUtils::VideoHeaderYres));
+    videoHeader.Set("FOURCC", Napi::Number::New(env, NdiUtils::VideoHeaderFourCC));
+    videoHeader.Set("FRAME_RATE_N", Napi::Number::New(env, NdiUtils::VideoHeaderFrameRateN));
+    videoHeader.Set("FRAME_RATE_D", Napi::Number::New(env, NdiUtils::VideoHeaderFrameRateD));
+    videoHeader.Set("FRAME_FORMAT", Napi::Number::New(env, NdiUtils::VideoHeaderFrameFormat));
+    videoHeader.Set("LINE_STRIDE", Napi::Number::New(env, NdiUtils::VideoHeaderLineStride));
+    videoHeader.Set("TIMECODE", Napi::Number::New(env, NdiUtils::VideoHeaderTimecode));
+    videoHeader.Set("TIMESTAMP", Napi::Number::New(env, NdiUtils::VideoHeaderTimestamp));
+    videoHeader.Set("DATA_SIZE", Napi::Number::New(env, NdiUtils::VideoHeaderDataSize));
+    videoHeader.Set("BYTES_WRITTEN", Napi::Number::New(env, NdiUtils::VideoHeaderBytesWritten));
+    videoHeader.Set("LENGTH", Napi::Number::New(env, NdiUtils::VideoHeaderLength));
+    exports.Set("VideoHeader", videoHeader);
+    
+    Napi::Object audioHeader = Napi::Object::New(env);
+    audioHeader.Set("SAMPLE_RATE", Napi::Number::New(env, NdiUtils::AudioHeaderSampleRate));
+    audioHeader.Set("NO_CHANNELS", Napi::Number::New(env, NdiUtils::AudioHeaderNoChannels));
+    audioHeader.Set("NO_SAMPLES", Napi::Number::New(env, NdiUtils::AudioHeaderNoSamples));
+    audioHeader.Set("TIMECODE", Napi::Number::New(env, NdiUtils::AudioHeaderTimecode));
+    audioHeader.Set("TIMESTAMP", Napi::Number::New(env, NdiUtils::AudioHeaderTimestamp));
+    audioHeader.Set("DATA_SIZE", Napi::Number::New(env, NdiUtils::AudioHeaderDataSize));
+    audioHeader.Set("SAMPLES_WRITTEN", Napi::Number::New(env, NdiUtils::AudioHeaderSamplesWritten));
+    audioHeader.Set("LENGTH", Napi::Number::New(env, NdiUtils::AudioHeaderLength));
+    exports.Set("AudioHeader", audioHeader);
+    
     return exports;
 }
 
@@ -21,7 +21,9 @@
  */
 
 #include "ndi_async.h"
+#include "ndi_convert.h"
 #include "ndi_utils.h"
+#include "ndi_frame_pool.h"
 #include <cstring>
 
 // ============================================================================
@@ -32,7 +34,7 @@ WaitForSourcesWorker::WaitForSourcesWorker(
     Napi::Env env,
     NDIlib_find_instance_t finder,
     uint32_t timeout
-) : Napi::AsyncWorker(env),
+) : NdiAsyncWorker(env),
     m_finder(finder),
     m_timeout(timeout),
     m_changed(false),
@@ -80,7 +82,7 @@ void WaitForSourcesWorker::OnOK() {
 GetSourcesWorker::GetSourcesWorker(
     Napi::Env env,
     NDIlib_find_instance_t finder
-) : Napi::AsyncWorker(env),
+) : NdiAsyncWorker(env),
     m_finder(finder),
     m_deferred(Napi::Promise::Deferred::New(env))
 {
@@ -116,57 +118,238 @@ void GetSourcesWorker::OnOK() {
 // Receiver Async Workers
 // ============================================================================
 
+/**
+ * Store the header fields of a captured NDI video frame for the main thread
+ */
+static void StoreVideoHeader(const NDIlib_video_frame_v2_t& videoFrame, CapturedVideoFrame& frame) {
+    frame.valid = true;
+    frame.xres = videoFrame.xres;
+    frame.yres = videoFrame.yres;
+    frame.fourCC = videoFrame.FourCC;
+    frame.frameRateN = videoFrame.frame_rate_N;
+    frame.frameRateD = videoFrame.frame_rate_D;
+    frame.pictureAspectRatio = videoFrame.picture_aspect_ratio;
+    frame.frameFormat = videoFrame.frame_format_type;
+    frame.timecode = videoFrame.timecode;
+    frame.lineStride = videoFrame.line_stride_in_bytes;
+    frame.timestamp = videoFrame.timestamp;
+    
+    if (videoFrame.p_metadata) {
+        frame.metadata = videoFrame.p_metadata;
+    }
+}
+
+bool ScaleCapturedVideo(
+    const NDIlib_video_frame_v2_t& frame,
+    const VideoCaptureOptions& videoOptions,
+    NDIlib_video_frame_v2_t& scaled,
+    NdiUtils::FramePayload& data
+) {
+    NdiConvert::ConvertOptions convertOptions;
+    convertOptions.dither = videoOptions.dither;
+    
+    // Scaling first leaves the conversion a fraction of the pixels
+    if (videoOptions.convertTo && NdiConvert::CanConvert(frame.FourCC, videoOptions.convertTo)) {
+        NDIlib_video_frame_v2_t small;
+        NdiUtils::FramePayload smallData;
+        return NdiScale::ScaleVideoFrame(frame, videoOptions.proxy, small, smallData) &&
+               NdiConvert::ConvertVideoFrame(small, videoOptions.convertTo, scaled, data, convertOptions);
+    }
+    
+    return NdiScale::ScaleVideoFrame(frame, videoOptions.proxy, scaled, data);
+}
+
+/**
+ * Store a captured NDI video frame for the main thread. The NDI frame is
+ * either copied and freed here, or kept alive and handed to JS as-is.
+ */
+static void StoreVideoFrame(
+    const RecvHandle& receiver,
+    const NDIlib_video_frame_v2_t& videoFrame,
+    const VideoCaptureOptions& videoOptions,
+    CapturedVideoFrame& frame
+) {
+    StoreVideoHeader(videoFrame, frame);
+    
+    if (!videoFrame.p_data || videoFrame.line_stride_in_bytes <= 0) {
+        NDIlib_recv_free_video_v2(receiver.get(), &videoFrame);
+        return;
+    }
+    
+    // The proxy is made before the full frame is stored, which may hand NDI's
+    // buffer to JS. Frames that do not scale arrive at full size regardless.
+    if (videoOptions.proxy.Enabled()) {
+        NDIlib_video_frame_v2_t scaled;
+        
+        if (videoOptions.proxyOnly) {
+            if (ScaleCapturedVideo(videoFrame, videoOptions, scaled, frame.data)) {
+                StoreVideoHeader(scaled, frame);
+                NDIlib_recv_free_video_v2(receiver.get(), &videoFrame);
+                return;
+            }
+        } else {
+            std::unique_ptr<CapturedVideoFrame> proxy(new CapturedVideoFrame());
+            if (ScaleCapturedVideo(videoFrame, videoOptions, scaled, proxy->data)) {
+                StoreVideoHeader(scaled, *proxy);
+                frame.proxy = std::move(proxy);
+            }
+        }
+    }
+    
+    // Converting already copies, so it takes precedence over zero-copy
+    NDIlib_video_frame_v2_t converted;
+    NdiConvert::ConvertOptions convertOptions;
+    convertOptions.dither = videoOptions.dither;
+    
+    if (videoOptions.convertTo &&
+        NdiConvert::ConvertVideoFrame(videoFrame, videoOptions.convertTo, converted, frame.data, convertOptions)) {
+        frame.fourCC = converted.FourCC;
+        frame.lineStride = converted.line_stride_in_bytes;
+        NDIlib_recv_free_video_v2(receiver.get(), &videoFrame);
+        return;
+    }
+    
+    if (videoOptions.zeroCopy) {
+        // The frame goes back to NDI when the JS Buffer is collected or released
+        frame.data.data = videoFrame.p_data;
+        frame.data.size = NdiUtils::VideoFrameDataSize(videoFrame);
+        frame.data.release = [receiver, videoFrame]() {
+            NDIlib_recv_free_video_v2(receiver.get(), &videoFrame);
+        };
+        return;
+    }
+    
+    NdiFramePool::CopyVideoFrame(videoFrame, frame.data);
+    NDIlib_recv_free_video_v2(receiver.get(), &videoFrame);
+}
+
+/**
+ * Store the header fields of a captured NDI audio frame for the main thread
+ */
+static void StoreAudioHeader(const NDIlib_audio_frame_v2_t& audioFrame, CapturedAudioFrame& frame) {
+    frame.valid = true;
+    frame.sampleRate = audioFrame.sample_rate;
+    frame.noChannels = audioFrame.no_channels;
+    frame.noSamples = audioFrame.no_samples;
+    frame.timecode = audioFrame.timecode;
+    frame.channelStride = audioFrame.channel_stride_in_bytes;
+    frame.timestamp = audioFrame.timestamp;
+    
+    if (audioFrame.p_metadata) {
+        frame.metadata = audioFrame.p_metadata;
+    }
+}
+
+/**
+ * Store a captured NDI audio frame for the main thread and free it
+ */
+static void StoreAudioFrame(
+    const RecvHandle& receiver,
+    const NDIlib_audio_frame_v2_t& audioFrame,
+    CapturedAudioFrame& frame
+) {
+    StoreAudioHeader(audioFrame, frame);
+    
+    NdiFramePool::CopyAudioFrame(audioFrame, frame.data);
+    
+    NDIlib_recv_free_audio_v2(receiver.get(), &audioFrame);
+}
+
+/**
+ * Build the JavaScript object for a video frame captured on a worker thread
+ */
+Napi::Object CapturedVideoToObject(Napi::Env env, CapturedVideoFrame& frame) {
+    NdiUtils::FrameObjectBuilder builder(env);
+    builder.Set(NdiUtils::FrameKeyXres, frame.xres);
+    builder.Set(NdiUtils::FrameKeyYres, frame.yres);
+    builder.SetInterned(NdiUtils::FrameKeyFourCC, NdiUtils::FourCCToString(frame.fourCC));
+    builder.Set(NdiUtils::FrameKeyFrameRateN, frame.frameRateN);
+    builder.Set(NdiUtils::FrameKeyFrameRateD, frame.frameRateD);
+    builder.Set(NdiUtils::FrameKeyPictureAspectRatio, frame.pictureAspectRatio);
+    builder.SetInterned(NdiUtils::FrameKeyFrameFormat, NdiUtils::FrameFormatToString(frame.frameFormat));
+    builder.Set(NdiUtils::FrameKeyTimecode, static_cast<double>(frame.timecode));
+    builder.Set(NdiUtils::FrameKeyLineStride, frame.lineStride);
+    builder.Set(NdiUtils::FrameKeyTimestamp, static_cast<double>(frame.timestamp));
+    builder.SetOptional(NdiUtils::FrameKeyMetadata, frame.metadata.empty() ? nullptr : frame.metadata.c_str());
+    
+    // The worker's copy becomes the Buffer's backing store, no second copy
+    if (!frame.data.Empty()) {
+        builder.Set(NdiUtils::FrameKeyData, frame.data.ToBuffer(env));
+        builder.Set(NdiUtils::FrameKeyRelease, NdiUtils::FrameReleaseFunction(env));
+    } else {
+        builder.Set(NdiUtils::FrameKeyData, env.Undefined());
+        builder.Set(NdiUtils::FrameKeyRelease, env.Undefined());
+    }
+    
+    // Undefined rather than absent without a proxy, so frames with and
+    // without one, and the proxy itself, share a hidden class
+    if (frame.proxy) {
+        builder.Set(NdiUtils::FrameKeyProxy, CapturedVideoToObject(env, *frame.proxy));
+    } else {
+        builder.Set(NdiUtils::FrameKeyProxy, env.Undefined());
+    }
+    
+    return builder.Build();
+}
+
+/**
+ * Build the JavaScript object for an audio frame captured on a worker thread
+ */
+static Napi::Object CapturedAudioToObject(Napi::Env env, CapturedAudioFrame& frame) {
+    NdiUtils::FrameObjectBuilder builder(env);
+    builder.Set(NdiUtils::FrameKeySampleRate, frame.sampleRate);
+    builder.Set(NdiUtils::FrameKeyNoChannels, frame.noChannels);
+    builder.Set(NdiUtils::FrameKeyNoSamples, frame.noSamples);
+    builder.Set(NdiUtils::FrameKeyTimecode, static_cast<double>(frame.timecode));
+    builder.Set(NdiUtils::FrameKeyChannelStride, frame.channelStride);
+    builder.Set(NdiUtils::FrameKeyTimestamp, static_cast<double>(frame.timestamp));
+    builder.SetOptional(NdiUtils::FrameKeyMetadata, frame.metadata.empty() ? nullptr : frame.metadata.c_str());
+    
+    if (!frame.data.Empty()) {
+        builder.Set(NdiUtils::FrameKeyData, frame.data.ToFloat32Array(env));
+        builder.Set(NdiUtils::FrameKeyRelease, NdiUtils::FrameReleaseFunction(env));
+    } else {
+        builder.Set(NdiUtils::FrameKeyData, env.Undefined());
+        builder.Set(NdiUtils::FrameKeyRelease, env.Undefined());
+    }
+    
+    return builder.Build();
+}
+
 CaptureVideoWorker::CaptureVideoWorker(
     Napi::Env env,
-    NDIlib_recv_instance_t receiver,
-    uint32_t timeout
-) : Napi::AsyncWorker(env),
+    RecvHandle receiver,
+    uint32_t timeout,
+    const VideoCaptureOptions& videoOptions
+) : NdiAsyncWorker(env),
     m_receiver(receiver),
     m_timeout(timeout),
+    m_videoOptions(videoOptions),
     m_deferred(Napi::Promise::Deferred::New(env))
 {
     m_frame.valid = false;
 }
 
-void CaptureVideoWorker::Execute() {
+void CaptureVideoFrame(const RecvHandle& receiver, uint32_t timeout, const VideoCaptureOptions& videoOptions, CapturedVideoFrame& frame) {
     NDIlib_video_frame_v2_t videoFrame = {};
     
     NDIlib_frame_type_e frameType = NDIlib_recv_capture_v2(
-        m_receiver,
+        receiver.get(),
         &videoFrame,
         nullptr,
         nullptr,
-        m_timeout
+        timeout
     );
     
     if (frameType == NDIlib_frame_type_video) {
-        m_frame.valid = true;
-        m_frame.xres = videoFrame.xres;
-        m_frame.yres = videoFrame.yres;
-        m_frame.fourCC = NdiUtils::FourCCToString(videoFrame.FourCC);
-        m_frame.frameRateN = videoFrame.frame_rate_N;
-        m_frame.frameRateD = videoFrame.frame_rate_D;
-        m_frame.pictureAspectRatio = videoFrame.picture_aspect_ratio;
-        m_frame.frameFormat = NdiUtils::FrameFormatToString(videoFrame.frame_format_type);
-        m_frame.timecode = videoFrame.timecode;
-        m_frame.lineStride = videoFrame.line_stride_in_bytes;
-        m_frame.timestamp = videoFrame.timestamp;
-        
-        if (videoFrame.p_metadata) {
-            m_frame.metadata = videoFrame.p_metadata;
-        }
-        
-        // Copy frame data
-        if (videoFrame.p_data && videoFrame.line_stride_in_bytes > 0) {
-            size_t dataSize = static_cast<size_t>(videoFrame.line_stride_in_bytes) * videoFrame.yres;
-            m_frame.data.resize(dataSize);
-            memcpy(m_frame.data.data(), videoFrame.p_data, dataSize);
-        }
-        
-        NDIlib_recv_free_video_v2(m_receiver, &videoFrame);
+        StoreVideoFrame(receiver, videoFrame, videoOptions, frame);
     }
 }
 
+void CaptureVideoWorker::Execute() {
+    CaptureVideoFrame(m_receiver, m_timeout, m_videoOptions, m_frame);
+}
+
 void CaptureVideoWorker::OnOK() {
     Napi::Env env = Env();
     Napi::HandleScope scope(env);
@@ -176,37 +359,14 @@ void CaptureVideoWorker::OnOK() {
         return;
     }
     
-    Napi::Object result = Napi::Object::New(env);
-    result.Set("xres", Napi::Number::New(env, m_frame.xres));
-    result.Set("yres", Napi::Number::New(env, m_frame.yres));
-    result.Set("fourCC", Napi::String::New(env, m_frame.fourCC));
-    result.Set("frameRateN", Napi::Number::New(env, m_frame.frameRateN));
-    result.Set("frameRateD", Napi::Number::New(env, m_frame.frameRateD));
-    result.Set("pictureAspectRatio", Napi::Number::New(env, m_frame.pictureAspectRatio));
-    result.Set("frameFormat", Napi::String::New(env, m_frame.frameFormat));
-    result.Set("timecode", Napi::Number::New(env, static_cast<double>(m_frame.timecode)));
-    result.Set("lineStride", Napi::Number::New(env, m_frame.lineStride));
-    result.Set("timestamp", Napi::Number::New(env, static_cast<double>(m_frame.timestamp)));
-    
-    if (!m_frame.metadata.empty()) {
-        result.Set("metadata", Napi::String::New(env, m_frame.metadata));
-    }
-    
-    if (!m_frame.data.empty()) {
-        Napi::Buffer<uint8_t> dataBuffer = Napi::Buffer<uint8_t>::Copy(
-            env, m_frame.data.data(), m_frame.data.size()
-        );
-        result.Set("data", dataBuffer);
-    }
-    
-    m_deferred.Resolve(result);
+    m_deferred.Resolve(CapturedVideoToObject(env, m_frame));
 }
 
 CaptureAudioWorker::CaptureAudioWorker(
     Napi::Env env,
-    NDIlib_recv_instance_t receiver,
+    RecvHandle receiver,
     uint32_t timeout
-) : Napi::AsyncWorker(env),
+) : NdiAsyncWorker(env),
     m_receiver(receiver),
     m_timeout(timeout),
     m_deferred(Napi::Promise::Deferred::New(env))
@@ -218,7 +378,7 @@ void CaptureAudioWorker::Execute() {
     NDIlib_audio_frame_v2_t audioFrame = {};
     
     NDIlib_frame_type_e frameType = NDIlib_recv_capture_v2(
-        m_receiver,
+        m_receiver.get(),
         nullptr,
         &audioFrame,
         nullptr,
@@ -226,26 +386,7 @@ void CaptureAudioWorker::Execute() {
     );
     
     if (frameType == NDIlib_frame_type_audio) {
-        m_frame.valid = true;
-        m_frame.sampleRate = audioFrame.sample_rate;
-        m_frame.noChannels = audioFrame.no_channels;
-        m_frame.noSamples = audioFrame.no_samples;
-        m_frame.timecode = audioFrame.timecode;
-        m_frame.channelStride = audioFrame.channel_stride_in_bytes;
-        m_frame.timestamp = audioFrame.timestamp;
-        
-        if (audioFrame.p_metadata) {
-            m_frame.metadata = audioFrame.p_metadata;
-        }
-        
-        // Copy audio data
-        if (audioFrame.p_data && audioFrame.no_samples > 0 && audioFrame.no_channels > 0) {
-            size_t dataSize = static_cast<size_t>(audioFrame.no_samples) * audioFrame.no_channels;
-            m_frame.data.resize(dataSize);
-            memcpy(m_frame.data.data(), audioFrame.p_data, dataSize * sizeof(float));
-        }
-        
-        NDIlib_recv_free_audio_v2(m_receiver, &audioFrame);
+        StoreAudioFrame(m_receiver, audioFrame, m_frame);
     }
 }
 
@@ -258,199 +399,246 @@ void CaptureAudioWorker::OnOK() {
         return;
     }
     
-    Napi::Object result = Napi::Object::New(env);
-    result.Set("sampleRate", Napi::Number::New(env, m_frame.sampleRate));
-    result.Set("noChannels", Napi::Number::New(env, m_frame.noChannels));
-    result.Set("noSamples", Napi::Number::New(env, m_frame.noSamples));
-    result.Set("timecode", Napi::Number::New(env, static_cast<double>(m_frame.timecode)));
-    result.Set("channelStride", Napi::Number::New(env, m_frame.channelStride));
-    result.Set("timestamp", Napi::Number::New(env, static_cast<double>(m_frame.timestamp)));
+    m_deferred.Resolve(CapturedAudioToObject(env, m_frame));
+}
+
+void CaptureFrame(
+    const RecvHandle& receiver,
+    uint32_t timeout,
+    const VideoCaptureOptions& videoOptions,
+    CapturedFrame& frame,
+    unsigned types
+) {
+    NDIlib_video_frame_v2_t videoFrame = {};
+    NDIlib_audio_frame_v2_t audioFrame = {};
+    NDIlib_metadata_frame_t metadataFrame = {};
+    
+    frame.type = NDIlib_recv_capture_v2(
+        receiver.get(),
+        (types & CaptureTypeVideo) ? &videoFrame : nullptr,
+        (types & CaptureTypeAudio) ? &audioFrame : nullptr,
+        (types & CaptureTypeMetadata) ? &metadataFrame : nullptr,
+        timeout
+    );
+    
+    switch (frame.type) {
+        case NDIlib_frame_type_video:
+            StoreVideoFrame(receiver, videoFrame, videoOptions, frame.video);
+            break;
+        
+        case NDIlib_frame_type_audio:
+            StoreAudioFrame(receiver, audioFrame, frame.audio);
+            break;
+        
+        case NDIlib_frame_type_metadata:
+            frame.metadata.valid = true;
+            frame.metadata.timecode = metadataFrame.timecode;
+            if (metadataFrame.p_data) {
+                frame.metadata.data = metadataFrame.p_data;
+            }
+            NDIlib_recv_free_metadata(receiver.get(), &metadataFrame);
+            break;
+        
+        default:
+            break;
+    }
+}
+
+Napi::Object CapturedFrameToObject(Napi::Env env, CapturedFrame& frame) {
+    Napi::Value video = env.Undefined();
+    Napi::Value audio = env.Undefined();
+    Napi::Value metadata = env.Undefined();
     
-    if (!m_frame.metadata.empty()) {
-        result.Set("metadata", Napi::String::New(env, m_frame.metadata));
+    if (frame.video.valid) {
+        video = CapturedVideoToObject(env, frame.video);
     }
     
-    if (!m_frame.data.empty()) {
-        Napi::Float32Array dataArray = Napi::Float32Array::New(env, m_frame.data.size());
-        memcpy(dataArray.Data(), m_frame.data.data(), m_frame.data.size() * sizeof(float));
-        result.Set("data", dataArray);
+    if (frame.audio.valid) {
+        audio = CapturedAudioToObject(env, frame.audio);
     }
     
-    m_deferred.Resolve(result);
+    if (frame.metadata.valid) {
+        NdiUtils::FrameObjectBuilder builder(env);
+        builder.Set(NdiUtils::FrameKeyData, Napi::String::New(env, frame.metadata.data));
+        builder.Set(NdiUtils::FrameKeyTimecode, static_cast<double>(frame.metadata.timecode));
+        metadata = builder.Build();
+    }
+    
+    return NdiUtils::CaptureResultToObject(env, frame.type, video, audio, metadata);
 }
 
 CaptureWorker::CaptureWorker(
     Napi::Env env,
-    NDIlib_recv_instance_t receiver,
-    uint32_t timeout
-) : Napi::AsyncWorker(env),
+    RecvHandle receiver,
+    uint32_t timeout,
+    const VideoCaptureOptions& videoOptions
+) : NdiAsyncWorker(env),
     m_receiver(receiver),
     m_timeout(timeout),
-    m_frameType(NDIlib_frame_type_none),
+    m_videoOptions(videoOptions),
     m_deferred(Napi::Promise::Deferred::New(env))
 {
-    m_videoFrame.valid = false;
-    m_audioFrame.valid = false;
-    m_metadataFrame.valid = false;
 }
 
 void CaptureWorker::Execute() {
+    CaptureFrame(m_receiver, m_timeout, m_videoOptions, m_frame);
+}
+
+void CaptureWorker::OnOK() {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+    
+    m_deferred.Resolve(CapturedFrameToObject(env, m_frame));
+}
+
+CaptureVideoIntoWorker::CaptureVideoIntoWorker(
+    Napi::Env env,
+    RecvHandle receiver,
+    Napi::TypedArray target,
+    uint32_t timeout
+) : NdiAsyncWorker(env),
+    m_receiver(receiver),
+    m_target(Napi::Persistent(static_cast<Napi::Object>(target))),
+    m_dst(static_cast<uint8_t*>(target.ArrayBuffer().Data()) + target.ByteOffset()),
+    m_capacity(target.ByteLength()),
+    m_timeout(timeout),
+    m_dataSize(0),
+    m_bytesWritten(0),
+    m_deferred(Napi::Promise::Deferred::New(env))
+{
+    m_frame.valid = false;
+}
+
+void CaptureVideoIntoWorker::Execute() {
     NDIlib_video_frame_v2_t videoFrame = {};
-    NDIlib_audio_frame_v2_t audioFrame = {};
-    NDIlib_metadata_frame_t metadataFrame = {};
     
-    m_frameType = NDIlib_recv_capture_v2(
-        m_receiver,
+    NDIlib_frame_type_e frameType = NDIlib_recv_capture_v2(
+        m_receiver.get(),
         &videoFrame,
-        &audioFrame,
-        &metadataFrame,
+        nullptr,
+        nullptr,
         m_timeout
     );
     
-    switch (m_frameType) {
-        case NDIlib_frame_type_video:
-            m_videoFrame.valid = true;
-            m_videoFrame.xres = videoFrame.xres;
-            m_videoFrame.yres = videoFrame.yres;
-            m_videoFrame.fourCC = NdiUtils::FourCCToString(videoFrame.FourCC);
-            m_videoFrame.frameRateN = videoFrame.frame_rate_N;
-            m_videoFrame.frameRateD = videoFrame.frame_rate_D;
-            m_videoFrame.pictureAspectRatio = videoFrame.picture_aspect_ratio;
-            m_videoFrame.frameFormat = NdiUtils::FrameFormatToString(videoFrame.frame_format_type);
-            m_videoFrame.timecode = videoFrame.timecode;
-            m_videoFrame.lineStride = videoFrame.line_stride_in_bytes;
-            m_videoFrame.timestamp = videoFrame.timestamp;
-            
-            if (videoFrame.p_metadata) {
-                m_videoFrame.metadata = videoFrame.p_metadata;
-            }
-            
-            if (videoFrame.p_data && videoFrame.line_stride_in_bytes > 0) {
-                size_t dataSize = static_cast<size_t>(videoFrame.line_stride_in_bytes) * videoFrame.yres;
-                m_videoFrame.data.resize(dataSize);
-                memcpy(m_videoFrame.data.data(), videoFrame.p_data, dataSize);
-            }
-            
-            NDIlib_recv_free_video_v2(m_receiver, &videoFrame);
-            break;
-            
-        case NDIlib_frame_type_audio:
-            m_audioFrame.valid = true;
-            m_audioFrame.sampleRate = audioFrame.sample_rate;
-            m_audioFrame.noChannels = audioFrame.no_channels;
-            m_audioFrame.noSamples = audioFrame.no_samples;
-            m_audioFrame.timecode = audioFrame.timecode;
-            m_audioFrame.channelStride = audioFrame.channel_stride_in_bytes;
-            m_audioFrame.timestamp = audioFrame.timestamp;
-            
-            if (audioFrame.p_metadata) {
-                m_audioFrame.metadata = audioFrame.p_metadata;
-            }
-            
-            if (audioFrame.p_data && audioFrame.no_samples > 0 && audioFrame.no_channels > 0) {
-                size_t dataSize = static_cast<size_t>(audioFrame.no_samples) * audioFrame.no_channels;
-                m_audioFrame.data.resize(dataSize);
-                memcpy(m_audioFrame.data.data(), audioFrame.p_data, dataSize * sizeof(float));
-            }
-            
-            NDIlib_recv_free_audio_v2(m_receiver, &audioFrame);
-            break;
-            
-        case NDIlib_frame_type_metadata:
-            m_metadataFrame.valid = true;
-            m_metadataFrame.timecode = metadataFrame.timecode;
-            if (metadataFrame.p_data) {
-                m_metadataFrame.data = metadataFrame.p_data;
-            }
-            NDIlib_recv_free_metadata(m_receiver, &metadataFrame);
-            break;
-            
-        default:
-            break;
+    if (frameType != NDIlib_frame_type_video) {
+        return;
     }
+    
+    // The target stays referenced until OnOK, so it is safe to write from here
+    StoreVideoHeader(videoFrame, m_frame);
+    m_dataSize = NdiUtils::VideoFrameDataSize(videoFrame);
+    m_bytesWritten = NdiUtils::CopyVideoFrameData(videoFrame, m_dst, m_capacity);
+    NDIlib_recv_free_video_v2(m_receiver.get(), &videoFrame);
 }
 
-void CaptureWorker::OnOK() {
+void CaptureVideoIntoWorker::OnOK() {
     Napi::Env env = Env();
     Napi::HandleScope scope(env);
     
-    Napi::Object result = Napi::Object::New(env);
-    result.Set("type", Napi::String::New(env, NdiUtils::FrameTypeToString(m_frameType)));
-    
-    if (m_videoFrame.valid) {
-        Napi::Object videoObj = Napi::Object::New(env);
-        videoObj.Set("xres", Napi::Number::New(env, m_videoFrame.xres));
-        videoObj.Set("yres", Napi::Number::New(env, m_videoFrame.yres));
-        videoObj.Set("fourCC", Napi::String::New(env, m_videoFrame.fourCC));
-        videoObj.Set("frameRateN", Napi::Number::New(env, m_videoFrame.frameRateN));
-        videoObj.Set("frameRateD", Napi::Number::New(env, m_videoFrame.frameRateD));
-        videoObj.Set("pictureAspectRatio", Napi::Number::New(env, m_videoFrame.pictureAspectRatio));
-        videoObj.Set("frameFormat", Napi::String::New(env, m_videoFrame.frameFormat));
-        videoObj.Set("timecode", Napi::Number::New(env, static_cast<double>(m_videoFrame.timecode)));
-        videoObj.Set("lineStride", Napi::Number::New(env, m_videoFrame.lineStride));
-        videoObj.Set("timestamp", Napi::Number::New(env, static_cast<double>(m_videoFrame.timestamp)));
-        
-        if (!m_videoFrame.metadata.empty()) {
-            videoObj.Set("metadata", Napi::String::New(env, m_videoFrame.metadata));
-        }
-        
-        if (!m_videoFrame.data.empty()) {
-            Napi::Buffer<uint8_t> dataBuffer = Napi::Buffer<uint8_t>::Copy(
-                env, m_videoFrame.data.data(), m_videoFrame.data.size()
-            );
-            videoObj.Set("data", dataBuffer);
-        }
-        
-        result.Set("video", videoObj);
+    if (!m_frame.valid) {
+        m_deferred.Resolve(env.Null());
+        return;
     }
     
-    if (m_audioFrame.valid) {
-        Napi::Object audioObj = Napi::Object::New(env);
-        audioObj.Set("sampleRate", Napi::Number::New(env, m_audioFrame.sampleRate));
-        audioObj.Set("noChannels", Napi::Number::New(env, m_audioFrame.noChannels));
-        audioObj.Set("noSamples", Napi::Number::New(env, m_audioFrame.noSamples));
-        audioObj.Set("timecode", Napi::Number::New(env, static_cast<double>(m_audioFrame.timecode)));
-        audioObj.Set("channelStride", Napi::Number::New(env, m_audioFrame.channelStride));
-        audioObj.Set("timestamp", Napi::Number::New(env, static_cast<double>(m_audioFrame.timestamp)));
-        
-        if (!m_audioFrame.metadata.empty()) {
-            audioObj.Set("metadata", Napi::String::New(env, m_audioFrame.metadata));
-        }
-        
-        if (!m_audioFrame.data.empty()) {
-            Napi::Float32Array dataArray = Napi::Float32Array::New(env, m_audioFrame.data.size());
-            memcpy(dataArray.Data(), m_audioFrame.data.data(), m_audioFrame.data.size() * sizeof(float));
-            audioObj.Set("data", dataArray);
-        }
-        
-        result.Set("audio", audioObj);
+    Napi::Object result = CapturedVideoToObject(env, m_frame);
+    result.Set("dataSize", Napi::Number::New(env, static_cast<double>(m_dataSize)));
+    result.Set("bytesWritten", Napi::Number::New(env, static_cast<double>(m_bytesWritten)));
+    result.Set("truncated", Napi::Boolean::New(env, m_bytesWritten < m_dataSize));
+    m_deferred.Resolve(result);
+}
+
+void CaptureVideoIntoWorker::OnAbandon() {
+    m_target.SuppressDestruct();
+}
+
+CaptureAudioIntoWorker::CaptureAudioIntoWorker(
+    Napi::Env env,
+    RecvHandle receiver,
+    Napi::Float32Array target,
+    uint32_t timeout
+) : NdiAsyncWorker(env),
+    m_receiver(receiver),
+    m_target(Napi::Persistent(static_cast<Napi::Object>(target))),
+    m_dst(target.Data()),
+    m_capacity(target.ElementLength()),
+    m_timeout(timeout),
+    m_dataSize(0),
+    m_samplesWritten(0),
+    m_deferred(Napi::Promise::Deferred::New(env))
+{
+    m_frame.valid = false;
+}
+
+void CaptureAudioIntoWorker::Execute() {
+    NDIlib_audio_frame_v2_t audioFrame = {};
+    
+    NDIlib_frame_type_e frameType = NDIlib_recv_capture_v2(
+        m_receiver.get(),
+        nullptr,
+        &audioFrame,
+        nullptr,
+        m_timeout
+    );
+    
+    if (frameType != NDIlib_frame_type_audio) {
+        return;
     }
     
-    if (m_metadataFrame.valid) {
-        Napi::Object metadataObj = Napi::Object::New(env);
-        metadataObj.Set("data", Napi::String::New(env, m_metadataFrame.data));
-        metadataObj.Set("timecode", Napi::Number::New(env, static_cast<double>(m_metadataFrame.timecode)));
-        result.Set("metadata", metadataObj);
+    StoreAudioHeader(audioFrame, m_frame);
+    m_dataSize = static_cast<size_t>(audioFrame.no_samples) * audioFrame.no_channels * sizeof(float);
+    m_samplesWritten = NdiUtils::CopyAudioFrameData(audioFrame, m_dst, m_capacity);
+    NDIlib_recv_free_audio_v2(m_receiver.get(), &audioFrame);
+}
+
+void CaptureAudioIntoWorker::OnOK() {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+    
+    if (!m_frame.valid) {
+        m_deferred.Resolve(env.Null());
+        return;
     }
     
+    // Channels are packed back to back in the target
+    Napi::Object result = CapturedAudioToObject(env, m_frame);
+    result.Set("channelStride", Napi::Number::New(env, m_samplesWritten * static_cast<int>(sizeof(float))));
+    result.Set("dataSize", Napi::Number::New(env, static_cast<double>(m_dataSize)));
+    result.Set("samplesWritten", Napi::Number::New(env, m_samplesWritten));
+    result.Set("truncated", Napi::Boolean::New(env, m_samplesWritten < m_frame.noSamples));
     m_deferred.Resolve(result);
 }
 
+void CaptureAudioIntoWorker::OnAbandon() {
+    m_target.SuppressDestruct();
+}
+
 // ============================================================================
 // Sender Async Workers
 // ============================================================================
 
 SendVideoWorker::SendVideoWorker(
     Napi::Env env,
-    NDIlib_send_instance_t sender,
+    SendHandle sender,
     NDIlib_video_frame_v2_t frame,
-    uint8_t* dataBuffer
-) : Napi::AsyncWorker(env),
+    uint8_t* dataBuffer,
+    Napi::Value pinned,
+    bool recycle
+) : NdiAsyncWorker(env),
     m_sender(sender),
     m_frame(frame),
     m_dataBuffer(dataBuffer),
+    m_recycle(recycle),
     m_deferred(Napi::Promise::Deferred::New(env))
 {
+    if (!pinned.IsEmpty() && pinned.IsObject()) {
+        m_pinned = Napi::Persistent(pinned.As<Napi::Object>());
+    }
+    
+    // The metadata string may belong to a JavaScript-owned format
+    if (frame.p_metadata) {
+        m_metadata = frame.p_metadata;
+        m_frame.p_metadata = m_metadata.c_str();
+    }
 }
 
 SendVideoWorker::~SendVideoWorker() {
@@ -461,28 +649,121 @@ SendVideoWorker::~SendVideoWorker() {
 }
 
 void SendVideoWorker::Execute() {
-    NDIlib_send_send_video_v2(m_sender, &m_frame);
+    NDIlib_send_send_video_v2(m_sender.get(), &m_frame);
 }
 
 void SendVideoWorker::OnOK() {
+    Unpin();
     m_deferred.Resolve(Env().Undefined());
 }
 
 void SendVideoWorker::OnError(const Napi::Error& error) {
+    Unpin();
+    m_deferred.Reject(error.Value());
+}
+
+void SendVideoWorker::OnAbandon() {
+    m_pinned.SuppressDestruct();
+}
+
+void SendVideoWorker::Unpin() {
+    if (m_recycle && !m_pinned.IsEmpty()) {
+        NdiFramePool::EndSend(Env(), m_pinned.Value());
+    }
+    m_pinned.Reset();
+}
+
+SendVideoMultiWorker::SendVideoMultiWorker(
+    Napi::Env env,
+    std::vector<SendHandle> senders,
+    NDIlib_video_frame_v2_t frame,
+    Napi::Value pinned,
+    bool recycle
+) : NdiAsyncWorker(env),
+    m_fanOut(std::make_shared<FanOut>()),
+    m_recycle(recycle),
+    m_deferred(Napi::Promise::Deferred::New(env))
+{
+    m_fanOut->senders = std::move(senders);
+    m_fanOut->frame = frame;
+    m_fanOut->next = 0;
+    
+    if (frame.p_metadata) {
+        m_fanOut->metadata = frame.p_metadata;
+        m_fanOut->frame.p_metadata = m_fanOut->metadata.c_str();
+    }
+    m_fanOut->done = 0;
+    
+    if (!pinned.IsEmpty() && pinned.IsObject()) {
+        m_pinned = Napi::Persistent(pinned.As<Napi::Object>());
+    }
+}
+
+void SendVideoMultiWorker::SendClaimed(const std::shared_ptr<FanOut>& fanOut) {
+    size_t count = fanOut->senders.size();
+    size_t index;
+    
+    while ((index = fanOut->next++) < count) {
+        NDIlib_send_send_video_v2(fanOut->senders[index].get(), &fanOut->frame);
+        
+        std::lock_guard<std::mutex> lock(fanOut->mutex);
+        if (++fanOut->done == count) {
+            fanOut->cv.notify_all();
+        }
+    }
+}
+
+void SendVideoMultiWorker::Execute() {
+    std::shared_ptr<FanOut> fanOut = m_fanOut;
+    size_t count = fanOut->senders.size();
+    
+    // Clocked senders each block for a frame period, so they run side by side
+    for (size_t i = 1; i < count; i++) {
+        NdiExecutor::Instance().Submit([fanOut]() { SendClaimed(fanOut); });
+    }
+    
+    SendClaimed(fanOut);
+    
+    std::unique_lock<std::mutex> lock(fanOut->mutex);
+    fanOut->cv.wait(lock, [&fanOut, count]() { return fanOut->done == count; });
+}
+
+void SendVideoMultiWorker::OnOK() {
+    Unpin();
+    m_deferred.Resolve(Env().Undefined());
+}
+
+void SendVideoMultiWorker::OnError(const Napi::Error& error) {
+    Unpin();
     m_deferred.Reject(error.Value());
 }
 
+void SendVideoMultiWorker::OnAbandon() {
+    m_pinned.SuppressDestruct();
+}
+
+void SendVideoMultiWorker::Unpin() {
+    if (m_recycle && !m_pinned.IsEmpty()) {
+        NdiFramePool::EndSend(Env(), m_pinned.Value());
+    }
+    m_pinned.Reset();
+}
+
 SendAudioWorker::SendAudioWorker(
     Napi::Env env,
-    NDIlib_send_instance_t sender,
+    SendHandle sender,
     NDIlib_audio_frame_v2_t frame,
-    float* dataBuffer
-) : Napi::AsyncWorker(env),
+    float* dataBuffer,
+    Napi::Value pinned
+) : NdiAsyncWorker(env),
     m_sender(sender),
     m_frame(frame),
     m_dataBuffer(dataBuffer),
     m_deferred(Napi::Promise::Deferred::New(env))
 {
+    if (!pinned.IsEmpty() && pinned.IsObject()) {
+        m_pinned = Napi::Persistent(pinned.As<Napi::Object>());
+    }
 }
 
 SendAudioWorker::~SendAudioWorker() {
@@ -493,22 +774,28 @@ SendAudioWorker::~SendAudioWorker() {
 }
 
 void SendAudioWorker::Execute() {
-    NDIlib_send_send_audio_v2(m_sender, &m_frame);
+    NDIlib_send_send_audio_v2(m_sender.get(), &m_frame);
 }
 
 void SendAudioWorker::OnOK() {
+    m_pinned.Reset();
     m_deferred.Resolve(Env().Undefined());
 }
 
 void SendAudioWorker::OnError(const Napi::Error& error) {
+    m_pinned.Reset();
     m_deferred.Reject(error.Value());
 }
 
+void SendAudioWorker::OnAbandon() {
+    m_pinned.SuppressDestruct();
+}
+
 GetTallyWorker::GetTallyWorker(
     Napi::Env env,
-    NDIlib_send_instance_t sender,
+    SendHandle sender,
     uint32_t timeout
-) : Napi::AsyncWorker(env),
+) : NdiAsyncWorker(env),
     m_sender(sender),
     m_timeout(timeout),
     m_success(false),
@@ -518,7 +805,7 @@ GetTallyWorker::GetTallyWorker(
 }
 
 void GetTallyWorker::Execute() {
-    m_success = NDIlib_send_get_tally(m_sender, &m_tally, m_timeout);
+    m_success = NDIlib_send_get_tally(m_sender.get(), &m_tally, m_timeout);
 }
 
 void GetTallyWorker::OnOK() {
@@ -539,9 +826,9 @@ void GetTallyWorker::OnOK() {
 
 GetConnectionsWorker::GetConnectionsWorker(
     Napi::Env env,
-    NDIlib_send_instance_t sender,
+    SendHandle sender,
     uint32_t timeout
-) : Napi::AsyncWorker(env),
+) : NdiAsyncWorker(env),
     m_sender(sender),
     m_timeout(timeout),
     m_numConnections(0),
@@ -550,7 +837,7 @@ GetConnectionsWorker::GetConnectionsWorker(
 }
 
 void GetConnectionsWorker::Execute() {
-    m_numConnections = NDIlib_send_get_no_connections(m_sender, m_timeout);
+    m_numConnections = NDIlib_send_get_no_connections(m_sender.get(), m_timeout);
 }
 
 void GetConnectionsWorker::OnOK() {
@@ -17,7 +17,8 @@
  */
 
 /*
- * NDI Async Workers - Async worker classes for non-blocking NDI operations
+ * NDI Async Workers - Async worker classes for non-blocking NDI operations.
+ * Workers run on the addon's own NdiExecutor rather than the libuv threadpool.
  */
 
 #ifndef NDI_ASYNC_H
@@ -25,6 +26,13 @@
 
 #include <napi.h>
 #include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include "ndi_utils.h"
+#include "ndi_executor.h"
+#include "ndi_scale.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 
@@ -35,14 +43,14 @@
 /**
  * Async worker for waiting for NDI sources
  */
-class WaitForSourcesWorker : public Napi::AsyncWorker {
+class WaitForSourcesWorker : public NdiAsyncWorker {
 public:
     WaitForSourcesWorker(
         Napi::Env env,
         NDIlib_find_instance_t finder,
         uint32_t timeout
     );
-
+    
     void Execute() override;
     void OnOK() override;
     
@@ -59,13 +67,13 @@ private:
 /**
  * Async worker for getting current sources without blocking
  */
-class GetSourcesWorker : public Napi::AsyncWorker {
+class GetSourcesWorker : public NdiAsyncWorker {
 public:
     GetSourcesWorker(
         Napi::Env env,
         NDIlib_find_instance_t finder
     );
-
+    
     void Execute() override;
     void OnOK() override;
     
@@ -80,23 +88,32 @@ private:
 // Receiver Async Workers
 // ============================================================================
 
+/**
+ * Shared ownership of an NDI receiver. The instance is destroyed once the
+ * receiver object, in-flight workers and zero-copy frames have all let go.
+ */
+typedef std::shared_ptr<NDIlib_recv_instance_type> RecvHandle;
+
 /**
  * Captured frame data that can be passed between threads
  */
 struct CapturedVideoFrame {
     int xres;
     int yres;
-    std::string fourCC;
+    NDIlib_FourCC_video_type_e fourCC;
     int frameRateN;
     int frameRateD;
     float pictureAspectRatio;
-    std::string frameFormat;
+    NDIlib_frame_format_type_e frameFormat;
     int64_t timecode;
     int lineStride;
-    std::vector<uint8_t> data;
+    NdiUtils::FramePayload data;
     std::string metadata;
     int64_t timestamp;
     bool valid;
+    
+    // Downscaled copy made on the capturing thread, when one was asked for
+    std::unique_ptr<CapturedVideoFrame> proxy;
 };
 
 struct CapturedAudioFrame {
@@ -105,7 +122,7 @@ struct CapturedAudioFrame {
     int noSamples;
     int64_t timecode;
     int channelStride;
-    std::vector<float> data;
+    NdiUtils::FramePayload data;
     std::string metadata;
     int64_t timestamp;
     bool valid;
@@ -117,46 +134,118 @@ struct CapturedMetadataFrame {
     bool valid;
 };
 
+/**
+ * Any captured frame, tagged with the NDI frame type
+ */
+struct CapturedFrame {
+    NDIlib_frame_type_e type;
+    CapturedVideoFrame video;
+    CapturedAudioFrame audio;
+    CapturedMetadataFrame metadata;
+    
+    CapturedFrame() : type(NDIlib_frame_type_none) {
+        video.valid = false;
+        audio.valid = false;
+        metadata.valid = false;
+    }
+};
+
+// How captured video frames are handed to JavaScript
+struct VideoCaptureOptions {
+    // Give JS NDI's own buffer instead of a pooled copy
+    bool zeroCopy = false;
+    
+    // Convert frames to this FourCC while copying them out of NDI, where a
+    // kernel exists; 0 leaves every frame in the format it arrived in
+    NDIlib_FourCC_video_type_e convertTo = static_cast<NDIlib_FourCC_video_type_e>(0);
+    
+    // Dither rather than round when that conversion narrows 16-bit video
+    bool dither = false;
+    
+    // Also downscale each frame to this size, converted like the frame itself
+    NdiScale::ScaleOptions proxy;
+    
+    // Deliver the downscaled frame in place of the full one
+    bool proxyOnly = false;
+};
+
+// Downscale a frame to videoOptions.proxy and convert it to convertTo where
+// that applies. Returns false, leaving data empty, if it does not scale.
+bool ScaleCapturedVideo(
+    const NDIlib_video_frame_v2_t& frame,
+    const VideoCaptureOptions& videoOptions,
+    NDIlib_video_frame_v2_t& scaled,
+    NdiUtils::FramePayload& data
+);
+
+// Capture one video frame on the calling thread, frame.valid is false on timeout
+void CaptureVideoFrame(const RecvHandle& receiver, uint32_t timeout, const VideoCaptureOptions& videoOptions, CapturedVideoFrame& frame);
+
+// Build the JavaScript video frame object, handing the frame data to JS
+Napi::Object CapturedVideoToObject(Napi::Env env, CapturedVideoFrame& frame);
+
+// Frame types to ask NDI for; NDI discards the types left out
+enum CaptureTypes {
+    CaptureTypeVideo = 1,
+    CaptureTypeAudio = 2,
+    CaptureTypeMetadata = 4,
+    CaptureTypeAll = 7
+};
+
+// Capture one frame of any of the requested types on the calling thread
+void CaptureFrame(
+    const RecvHandle& receiver,
+    uint32_t timeout,
+    const VideoCaptureOptions& videoOptions,
+    CapturedFrame& frame,
+    unsigned types = CaptureTypeAll
+);
+
+// Build the { type, video | audio | metadata } object, handing the frame data to JS
+Napi::Object CapturedFrameToObject(Napi::Env env, CapturedFrame& frame);
+
 /**
  * Async worker for capturing video frames
  */
-class CaptureVideoWorker : public Napi::AsyncWorker {
+class CaptureVideoWorker : public NdiAsyncWorker {
 public:
     CaptureVideoWorker(
         Napi::Env env,
-        NDIlib_recv_instance_t receiver,
-        uint32_t timeout
+        RecvHandle receiver,
+        uint32_t timeout,
+        const VideoCaptureOptions& videoOptions
     );
-
+    
     void Execute() override;
     void OnOK() override;
     
     Napi::Promise::Deferred m_deferred;
 
 private:
-    NDIlib_recv_instance_t m_receiver;
+    RecvHandle m_receiver;
     uint32_t m_timeout;
+    VideoCaptureOptions m_videoOptions;
     CapturedVideoFrame m_frame;
 };
 
 /**
  * Async worker for capturing audio frames
  */
-class CaptureAudioWorker : public Napi::AsyncWorker {
+class CaptureAudioWorker : public NdiAsyncWorker {
 public:
     CaptureAudioWorker(
         Napi::Env env,
-        NDIlib_recv_instance_t receiver,
+        RecvHandle receiver,
         uint32_t timeout
     );
-
+    
     void Execute() override;
     void OnOK() override;
     
     Napi::Promise::Deferred m_deferred;
 
 private:
-    NDIlib_recv_instance_t m_receiver;
+    RecvHandle m_receiver;
     uint32_t m_timeout;
     CapturedAudioFrame m_frame;
 };
@@ -164,102 +253,226 @@ private:
 /**
  * Async worker for capturing any frame type
  */
-class CaptureWorker : public Napi::AsyncWorker {
+class CaptureWorker : public NdiAsyncWorker {
 public:
     CaptureWorker(
         Napi::Env env,
-        NDIlib_recv_instance_t receiver,
+        RecvHandle receiver,
+        uint32_t timeout,
+        const VideoCaptureOptions& videoOptions
+    );
+    
+    void Execute() override;
+    void OnOK() override;
+    
+    Napi::Promise::Deferred m_deferred;
+
+private:
+    RecvHandle m_receiver;
+    uint32_t m_timeout;
+    VideoCaptureOptions m_videoOptions;
+    CapturedFrame m_frame;
+};
+
+/**
+ * Async worker for capturing a video frame into a caller-supplied buffer
+ */
+class CaptureVideoIntoWorker : public NdiAsyncWorker {
+public:
+    CaptureVideoIntoWorker(
+        Napi::Env env,
+        RecvHandle receiver,
+        Napi::TypedArray target,
         uint32_t timeout
     );
+    
+    void Execute() override;
+    void OnOK() override;
+    void OnAbandon() override;
+    
+    Napi::Promise::Deferred m_deferred;
+
+private:
+    RecvHandle m_receiver;
+    Napi::ObjectReference m_target;
+    uint8_t* m_dst;
+    size_t m_capacity;
+    uint32_t m_timeout;
+    CapturedVideoFrame m_frame;
+    size_t m_dataSize;
+    size_t m_bytesWritten;
+};
 
+/**
+ * Async worker for capturing an audio frame into a caller-supplied Float32Array
+ */
+class CaptureAudioIntoWorker : public NdiAsyncWorker {
+public:
+    CaptureAudioIntoWorker(
+        Napi::Env env,
+        RecvHandle receiver,
+        Napi::Float32Array target,
+        uint32_t timeout
+    );
+    
     void Execute() override;
     void OnOK() override;
+    void OnAbandon() override;
     
     Napi::Promise::Deferred m_deferred;
 
 private:
-    NDIlib_recv_instance_t m_receiver;
+    RecvHandle m_receiver;
+    Napi::ObjectReference m_target;
+    float* m_dst;
+    size_t m_capacity;
     uint32_t m_timeout;
-    NDIlib_frame_type_e m_frameType;
-    CapturedVideoFrame m_videoFrame;
-    CapturedAudioFrame m_audioFrame;
-    CapturedMetadataFrame m_metadataFrame;
+    CapturedAudioFrame m_frame;
+    size_t m_dataSize;
+    int m_samplesWritten;
 };
 
 // ============================================================================
 // Sender Async Workers
 // ============================================================================
 
+/**
+ * Shared ownership of an NDI sender. The instance is destroyed once the
+ * sender object and in-flight send workers have all let go, so destroy()
+ * never pulls it out from under a pool thread that is still sending.
+ */
+typedef std::shared_ptr<NDIlib_send_instance_type> SendHandle;
+
 /**
  * Async worker for sending video frames
  */
-class SendVideoWorker : public Napi::AsyncWorker {
+class SendVideoWorker : public NdiAsyncWorker {
 public:
     SendVideoWorker(
         Napi::Env env,
-        NDIlib_send_instance_t sender,
+        SendHandle sender,
         NDIlib_video_frame_v2_t frame,
-        uint8_t* dataBuffer
+        uint8_t* dataBuffer,
+        Napi::Value pinned = Napi::Value(),
+        bool recycle = false
     );
     
     ~SendVideoWorker();
-
+    
     void Execute() override;
     void OnOK() override;
     void OnError(const Napi::Error& error) override;
+    void OnAbandon() override;
     
     Napi::Promise::Deferred m_deferred;
 
 private:
-    NDIlib_send_instance_t m_sender;
+    void Unpin();
+    
+    SendHandle m_sender;
     NDIlib_video_frame_v2_t m_frame;
     uint8_t* m_dataBuffer;
+    std::string m_metadata;
+    
+    // Buffer the frame points into when sent without a copy
+    Napi::ObjectReference m_pinned;
+    
+    // The pinned Buffer came from allocateVideoFrame() and is recycled after
+    bool m_recycle;
+};
+
+/**
+ * Async worker sending one video frame through several senders at once. The
+ * frame is parsed and pinned once; every pool thread that picks up a share of
+ * the work, including the worker's own, claims senders until none are left,
+ * so the send completes even when no other pool thread is free.
+ */
+class SendVideoMultiWorker : public NdiAsyncWorker {
+public:
+    SendVideoMultiWorker(
+        Napi::Env env,
+        std::vector<SendHandle> senders,
+        NDIlib_video_frame_v2_t frame,
+        Napi::Value pinned,
+        bool recycle
+    );
+    
+    void Execute() override;
+    void OnOK() override;
+    void OnError(const Napi::Error& error) override;
+    void OnAbandon() override;
+    
+    Napi::Promise::Deferred m_deferred;
+
+private:
+    // Outlives the worker: pool threads may pick up their share late
+    struct FanOut {
+        std::vector<SendHandle> senders;
+        NDIlib_video_frame_v2_t frame;
+        std::string metadata;
+        std::atomic<size_t> next;
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t done;
+    };
+    
+    static void SendClaimed(const std::shared_ptr<FanOut>& fanOut);
+    void Unpin();
+    
+    std::shared_ptr<FanOut> m_fanOut;
+    Napi::ObjectReference m_pinned;
+    bool m_recycle;
 };
 
 /**
  * Async worker for sending audio frames
  */
-class SendAudioWorker : public Napi::AsyncWorker {
+class SendAudioWorker : public NdiAsyncWorker {
 public:
     SendAudioWorker(
         Napi::Env env,
-        NDIlib_send_instance_t sender,
+        SendHandle sender,
         NDIlib_audio_frame_v2_t frame,
-        float* dataBuffer
+        float* dataBuffer,
+        Napi::Value pinned = Napi::Value()
     );
     
     ~SendAudioWorker();
-
+    
     void Execute() override;
     void OnOK() override;
     void OnError(const Napi::Error& error) override;
+    void OnAbandon() override;
     
     Napi::Promise::Deferred m_deferred;
 
 private:
-    NDIlib_send_instance_t m_sender;
+    SendHandle m_sender;
     NDIlib_audio_frame_v2_t m_frame;
     float* m_dataBuffer;
+    
+    // Buffer the frame points into when sent without a copy
+    Napi::ObjectReference m_pinned;
 };
 
 /**
  * Async worker for getting tally with timeout
  */
-class GetTallyWorker : public Napi::AsyncWorker {
+class GetTallyWorker : public NdiAsyncWorker {
 public:
     GetTallyWorker(
         Napi::Env env,
-        NDIlib_send_instance_t sender,
+        SendHandle sender,
         uint32_t timeout
     );
-
+    
     void Execute() override;
     void OnOK() override;
     
     Napi::Promise::Deferred m_deferred;
 
 private:
-    NDIlib_send_instance_t m_sender;
+    SendHandle m_sender;
     uint32_t m_timeout;
     NDIlib_tally_t m_tally;
     bool m_success;
@@ -268,21 +481,21 @@ private:
 /**
  * Async worker for getting connection count with timeout
  */
-class GetConnectionsWorker : public Napi::AsyncWorker {
+class GetConnectionsWorker : public NdiAsyncWorker {
 public:
     GetConnectionsWorker(
         Napi::Env env,
-        NDIlib_send_instance_t sender,
+        SendHandle sender,
         uint32_t timeout
     );
-
+    
     void Execute() override;
     void OnOK() override;
     
     Napi::Promise::Deferred m_deferred;
 
 private:
-    NDIlib_send_instance_t m_sender;
+    SendHandle m_sender;
     uint32_t m_timeout;
     int m_numConnections;
 };
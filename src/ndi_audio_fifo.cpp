@@ -0,0 +1,143 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * NDI Audio FIFO - Implementation
+ */
+
+#include "ndi_audio_fifo.h"
+#include <algorithm>
+#include <cstring>
+
+NdiAudioFifo::NdiAudioFifo(const Options& options)
+    : m_options(options),
+      m_capacity(0),
+      m_fill(0),
+      m_target(0),
+      m_framesEmitted(0)
+{
+    if (m_options.sampleRate <= 0) m_options.sampleRate = 48000;
+    if (m_options.channels <= 0) m_options.channels = 2;
+    if (m_options.frameRateN <= 0 || m_options.frameRateD <= 0) {
+        m_options.frameRateN = 30000;
+        m_options.frameRateD = 1001;
+    }
+    if (m_options.samplesPerFrame < 0) m_options.samplesPerFrame = 0;
+    
+    // Largest frame the pattern produces, a ceiling of samples per video frame
+    if (m_options.samplesPerFrame > 0) {
+        m_capacity = static_cast<size_t>(m_options.samplesPerFrame);
+    } else {
+        int64_t numerator = static_cast<int64_t>(m_options.sampleRate) * m_options.frameRateD;
+        m_capacity = static_cast<size_t>((numerator + m_options.frameRateN - 1) / m_options.frameRateN);
+    }
+    m_capacity = std::max<size_t>(m_capacity, 1);
+    
+    m_planes.resize(m_capacity * m_options.channels);
+    m_target = FrameSize(0);
+}
+
+size_t NdiAudioFifo::FrameSize(uint64_t index) const {
+    if (m_options.samplesPerFrame > 0) {
+        return static_cast<size_t>(m_options.samplesPerFrame);
+    }
+    
+    // Boundaries fall at floor(k * rate * D / N), so the fractional part of
+    // each frame is carried into the next instead of being rounded away
+    int64_t perFrame = static_cast<int64_t>(m_options.sampleRate) * m_options.frameRateD;
+    int64_t start = static_cast<int64_t>(index) * perFrame / m_options.frameRateN;
+    int64_t end = static_cast<int64_t>(index + 1) * perFrame / m_options.frameRateN;
+    return std::max<size_t>(static_cast<size_t>(end - start), 1);
+}
+
+size_t NdiAudioFifo::PushInterleaved(const float* data, size_t sampleCount, const EmitCallback& emit) {
+    size_t channels = static_cast<size_t>(m_options.channels);
+    size_t emitted = 0;
+    
+    while (sampleCount > 0) {
+        size_t take = std::min(sampleCount, m_target - m_fill);
+        
+        for (size_t ch = 0; ch < channels; ch++) {
+            float* dst = m_planes.data() + ch * m_capacity + m_fill;
+            const float* src = data + ch;
+            for (size_t i = 0; i < take; i++) {
+                dst[i] = src[i * channels];
+            }
+        }
+        
+        data += take * channels;
+        sampleCount -= take;
+        m_fill += take;
+        
+        if (m_fill == m_target) {
+            Emit(emit);
+            emitted++;
+        }
+    }
+    
+    return emitted;
+}
+
+size_t NdiAudioFifo::PushPlanar(const float* const* channels, size_t sampleCount, const EmitCallback& emit) {
+    size_t offset = 0;
+    size_t emitted = 0;
+    
+    while (offset < sampleCount) {
+        size_t take = std::min(sampleCount - offset, m_target - m_fill);
+        
+        for (int ch = 0; ch < m_options.channels; ch++) {
+            memcpy(m_planes.data() + ch * m_capacity + m_fill, channels[ch] + offset, take * sizeof(float));
+        }
+        
+        offset += take;
+        m_fill += take;
+        
+        if (m_fill == m_target) {
+            Emit(emit);
+            emitted++;
+        }
+    }
+    
+    return emitted;
+}
+
+bool NdiAudioFifo::Flush(const EmitCallback& emit) {
+    if (m_fill == 0) {
+        return false;
+    }
+    
+    Emit(emit);
+    return true;
+}
+
+void NdiAudioFifo::Emit(const EmitCallback& emit) {
+    NDIlib_audio_frame_v2_t frame = {};
+    frame.sample_rate = m_options.sampleRate;
+    frame.no_channels = m_options.channels;
+    frame.no_samples = static_cast<int>(m_fill);
+    frame.timecode = NDIlib_send_timecode_synthesize;
+    frame.p_data = m_planes.data();
+    frame.channel_stride_in_bytes = static_cast<int>(m_capacity * sizeof(float));
+    
+    emit(frame);
+    
+    m_framesEmitted++;
+    m_fill = 0;
+    m_target = FrameSize(m_framesEmitted);
+}
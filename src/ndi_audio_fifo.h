@@ -0,0 +1,83 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * NDI Audio FIFO - Regroups arbitrarily sized audio blocks into NDI frames
+ */
+
+#ifndef NDI_AUDIO_FIFO_H
+#define NDI_AUDIO_FIFO_H
+
+#include <napi.h>
+#include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * Collects planar float audio pushed in blocks of any size (a 128-sample
+ * WebAudio render quantum, say) and emits whole frames. By default a frame
+ * covers one video frame duration; at rates like 48 kHz / 29.97 fps that is
+ * not a whole number of samples, so frame sizes alternate (1602, 1601, ...)
+ * with the remainder carried over and no drift against video.
+ */
+class NdiAudioFifo {
+public:
+    struct Options {
+        int sampleRate = 48000;
+        int channels = 2;
+        int frameRateN = 30000;
+        int frameRateD = 1001;
+        
+        // Fixed frame size, or 0 to follow the video frame duration
+        int samplesPerFrame = 0;
+    };
+    
+    // Called with each completed frame; its data is only valid during the call
+    typedef std::function<void(const NDIlib_audio_frame_v2_t&)> EmitCallback;
+    
+    explicit NdiAudioFifo(const Options& options);
+    
+    // Append sampleCount samples per channel, return the frames emitted
+    size_t PushInterleaved(const float* data, size_t sampleCount, const EmitCallback& emit);
+    size_t PushPlanar(const float* const* channels, size_t sampleCount, const EmitCallback& emit);
+    
+    // Emit whatever is pending as a shorter frame, returns false if nothing was
+    bool Flush(const EmitCallback& emit);
+    
+    int Channels() const { return m_options.channels; }
+    size_t PendingSamples() const { return m_fill; }
+    uint64_t FramesEmitted() const { return m_framesEmitted; }
+
+private:
+    // Samples in the frame with this index
+    size_t FrameSize(uint64_t index) const;
+    void Emit(const EmitCallback& emit);
+    
+    Options m_options;
+    size_t m_capacity;
+    
+    // One channel after another, m_capacity samples each
+    std::vector<float> m_planes;
+    size_t m_fill;
+    size_t m_target;
+    uint64_t m_framesEmitted;
+};
+
+#endif // NDI_AUDIO_FIFO_H
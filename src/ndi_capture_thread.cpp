@@ -0,0 +1,316 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Capture Thread - Implementation
+ */
+
+#include "ndi_capture_thread.h"
+#include <algorithm>
+#include <vector>
+
+NdiCaptureThread::FrameQueue& NdiCaptureThread::Shared::QueueFor(NDIlib_frame_type_e type) {
+    if (pull) {
+        return video;
+    }
+    
+    switch (type) {
+        case NDIlib_frame_type_video:
+            return video;
+        case NDIlib_frame_type_audio:
+            return audio;
+        default:
+            // Metadata, status changes and errors share one queue
+            return metadata;
+    }
+}
+
+NdiCaptureThread::NdiCaptureThread(
+    Napi::Env env,
+    Napi::Function callback,
+    RecvHandle receiver,
+    const Options& options,
+    const VideoCaptureOptions& videoOptions
+) : m_receiver(receiver),
+    m_options(options),
+    m_videoOptions(videoOptions),
+    m_shared(std::make_shared<Shared>(options, false))
+{
+    m_tsfn = Napi::ThreadSafeFunction::New(env, callback, "NdiCaptureThread", 0, 1);
+    m_thread = std::thread(&NdiCaptureThread::Run, this);
+}
+
+NdiCaptureThread::NdiCaptureThread(
+    Napi::Env env,
+    RecvHandle receiver,
+    const Options& options,
+    const VideoCaptureOptions& videoOptions
+) : m_receiver(receiver),
+    m_options(options),
+    m_videoOptions(videoOptions),
+    m_shared(std::make_shared<Shared>(options, true))
+{
+    m_tsfn = Napi::ThreadSafeFunction::New(env, Napi::Function(), "NdiCaptureThread", 0, 1);
+    m_thread = std::thread(&NdiCaptureThread::Run, this);
+}
+
+NdiCaptureThread::~NdiCaptureThread() {
+    Stop();
+}
+
+void NdiCaptureThread::Pause() {
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    m_shared->paused = true;
+}
+
+void NdiCaptureThread::Resume() {
+    {
+        std::lock_guard<std::mutex> lock(m_shared->mutex);
+        m_shared->paused = false;
+    }
+    m_shared->cv.notify_all();
+}
+
+bool NdiCaptureThread::IsPaused() {
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    return m_shared->paused;
+}
+
+bool NdiCaptureThread::IsRunning() {
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    return !m_shared->stopping;
+}
+
+void NdiCaptureThread::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_shared->mutex);
+        if (m_shared->stopping) {
+            return;
+        }
+        m_shared->stopping = true;
+    }
+    m_shared->cv.notify_all();
+    
+    // The thread only ever waits on the condition variable or inside NDI for
+    // at most the capture timeout, so joining never depends on the event loop
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    
+    m_tsfn.Release();
+    
+    // Frames not yet delivered go back to the pool / NDI here
+    QueuedFramePtr dropped;
+    while (m_shared->video.ring.TryPop(dropped)) {}
+    while (m_shared->audio.ring.TryPop(dropped)) {}
+    while (m_shared->metadata.ring.TryPop(dropped)) {}
+    
+    // End any iteration waiting on a frame
+    while (!m_shared->waiters.empty()) {
+        Napi::Promise::Deferred waiter = m_shared->waiters.front();
+        m_shared->waiters.pop_front();
+        waiter.Resolve(waiter.Env().Null());
+    }
+}
+
+NdiCaptureThread::QueueStats NdiCaptureThread::GetQueueStats(NDIlib_frame_type_e type) {
+    FrameQueue& queue = m_shared->QueueFor(type);
+    
+    QueueStats stats;
+    stats.enqueued = queue.enqueued.load();
+    stats.dropped = queue.dropped.load();
+    stats.highWaterMark = queue.highWaterMark.load();
+    stats.depth = queue.ring.Size();
+    stats.capacity = queue.ring.Capacity();
+    return stats;
+}
+
+Napi::Promise NdiCaptureThread::Next(Napi::Env env) {
+    Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+    QueuedFramePtr queued;
+    
+    if (!IsRunning()) {
+        deferred.Resolve(env.Null());
+    } else if (m_shared->waiters.empty() && m_shared->video.ring.TryPop(queued)) {
+        WakeProducer(m_shared);
+        deferred.Resolve(CapturedFrameToObject(env, queued->frame));
+    } else {
+        m_shared->waiters.push_back(deferred);
+    }
+    
+    return deferred.Promise();
+}
+
+void NdiCaptureThread::Run() {
+    std::shared_ptr<Shared> shared = m_shared;
+    uint64_t sequence = 0;
+    
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(shared->mutex);
+            shared->cv.wait(lock, [&shared]() {
+                return shared->stopping || !shared->paused;
+            });
+            
+            if (shared->stopping) {
+                break;
+            }
+        }
+        
+        QueuedFramePtr queued(new QueuedFrame());
+        CaptureFrame(m_receiver, m_options.timeout, m_videoOptions, queued->frame, m_options.types);
+        
+        if (queued->frame.type == NDIlib_frame_type_none) {
+            continue;
+        }
+        
+        // Iterators only yield media; status changes and errors are skipped
+        if (shared->pull &&
+            !queued->frame.video.valid &&
+            !queued->frame.audio.valid &&
+            !queued->frame.metadata.valid) {
+            continue;
+        }
+        
+        queued->sequence = sequence++;
+        
+        if (!Enqueue(shared->QueueFor(queued->frame.type), queued)) {
+            continue;
+        }
+        
+        // One pending delivery drains everything queued before it runs
+        if (!shared->wakePending.exchange(true)) {
+            m_tsfn.NonBlockingCall([shared](Napi::Env env, Napi::Function callback) {
+                if (shared->pull) {
+                    ResolveWaiters(env, shared);
+                } else {
+                    Deliver(env, callback, shared);
+                }
+            });
+        }
+    }
+}
+
+bool NdiCaptureThread::Enqueue(FrameQueue& queue, QueuedFramePtr& frame) {
+    while (!queue.ring.TryPush(frame)) {
+        switch (m_options.dropPolicy) {
+            case DropNewest:
+                queue.dropped++;
+                return false;
+            
+            case DropOldest: {
+                QueuedFramePtr oldest;
+                if (queue.ring.TryPop(oldest)) {
+                    queue.dropped++;
+                }
+                break;
+            }
+            
+            case Block: {
+                // Woken by WakeProducer() once the consumer has popped
+                std::unique_lock<std::mutex> lock(m_shared->mutex);
+                m_shared->cv.wait(lock, [this, &queue]() {
+                    return m_shared->stopping || queue.ring.Size() < queue.ring.Capacity();
+                });
+                
+                if (m_shared->stopping) {
+                    return false;
+                }
+                break;
+            }
+        }
+    }
+    
+    queue.enqueued++;
+    
+    size_t depth = queue.ring.Size();
+    if (depth > queue.highWaterMark.load(std::memory_order_relaxed)) {
+        queue.highWaterMark.store(depth, std::memory_order_relaxed);
+    }
+    
+    return true;
+}
+
+void NdiCaptureThread::Deliver(Napi::Env env, Napi::Function callback, const std::shared_ptr<Shared>& shared) {
+    // Clear the flag first so frames pushed while draining schedule another call
+    shared->wakePending.store(false);
+    
+    std::vector<QueuedFramePtr> frames;
+    QueuedFramePtr queued;
+    while (shared->video.ring.TryPop(queued)) {
+        frames.push_back(std::move(queued));
+    }
+    while (shared->audio.ring.TryPop(queued)) {
+        frames.push_back(std::move(queued));
+    }
+    while (shared->metadata.ring.TryPop(queued)) {
+        frames.push_back(std::move(queued));
+    }
+    
+    WakeProducer(shared);
+    
+    std::sort(frames.begin(), frames.end(), [](const QueuedFramePtr& a, const QueuedFramePtr& b) {
+        return a->sequence < b->sequence;
+    });
+    
+    for (auto& frame : frames) {
+        // Capture may have been stopped, possibly by a listener in this batch
+        {
+            std::lock_guard<std::mutex> lock(shared->mutex);
+            if (shared->stopping) {
+                break;
+            }
+        }
+        
+        Napi::HandleScope scope(env);
+        callback.Call({ CapturedFrameToObject(env, frame->frame) });
+        
+        // Let a throwing listener surface as an uncaught exception
+        if (env.IsExceptionPending()) {
+            break;
+        }
+    }
+}
+
+void NdiCaptureThread::ResolveWaiters(Napi::Env env, const std::shared_ptr<Shared>& shared) {
+    shared->wakePending.store(false);
+    
+    bool popped = false;
+    QueuedFramePtr queued;
+    
+    while (!shared->waiters.empty() && shared->video.ring.TryPop(queued)) {
+        Napi::HandleScope scope(env);
+        Napi::Promise::Deferred waiter = shared->waiters.front();
+        shared->waiters.pop_front();
+        waiter.Resolve(CapturedFrameToObject(env, queued->frame));
+        popped = true;
+    }
+    
+    if (popped) {
+        WakeProducer(shared);
+    }
+}
+
+void NdiCaptureThread::WakeProducer(const std::shared_ptr<Shared>& shared) {
+    // Taking the lock first means a producer in Enqueue() cannot miss the
+    // wakeup between checking the queue and starting to wait
+    {
+        std::lock_guard<std::mutex> lock(shared->mutex);
+    }
+    shared->cv.notify_all();
+}
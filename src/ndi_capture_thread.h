@@ -0,0 +1,165 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Capture Thread - Dedicated receive loop delivering frames to JavaScript
+ */
+
+#ifndef NDI_CAPTURE_THREAD_H
+#define NDI_CAPTURE_THREAD_H
+
+#include <napi.h>
+#include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include "ndi_async.h"
+#include "ndi_ring_buffer.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * Runs NDIlib_recv_capture_v2 in a loop on its own thread and hands every
+ * frame to a JavaScript callback through a ThreadSafeFunction. While the
+ * event loop is busy, frames wait in a lock-free ring per media type; what
+ * happens when a ring fills up is chosen by the drop policy.
+ *
+ * In pull mode there is no callback: frames of all types wait in the video
+ * ring, in capture order, until Next() takes them. Combined with the Block
+ * policy the thread stops capturing while the consumer is behind.
+ */
+class NdiCaptureThread {
+public:
+    enum DropPolicy {
+        DropOldest,
+        DropNewest,
+        Block
+    };
+    
+    struct Options {
+        uint32_t timeout = 100;
+        size_t videoDepth = 4;
+        size_t audioDepth = 16;
+        size_t metadataDepth = 16;
+        DropPolicy dropPolicy = DropOldest;
+        unsigned types = CaptureTypeAll;
+    };
+    
+    struct QueueStats {
+        uint64_t enqueued;
+        uint64_t dropped;
+        size_t highWaterMark;
+        size_t depth;
+        size_t capacity;
+    };
+    
+    NdiCaptureThread(
+        Napi::Env env,
+        Napi::Function callback,
+        RecvHandle receiver,
+        const Options& options,
+        const VideoCaptureOptions& videoOptions
+    );
+    
+    // Pull mode
+    NdiCaptureThread(
+        Napi::Env env,
+        RecvHandle receiver,
+        const Options& options,
+        const VideoCaptureOptions& videoOptions
+    );
+    
+    ~NdiCaptureThread();
+    
+    void Pause();
+    void Resume();
+    bool IsPaused();
+    bool IsRunning();
+    
+    // Stop capturing, join the thread and drop frames not yet delivered
+    void Stop();
+    
+    QueueStats GetQueueStats(NDIlib_frame_type_e type);
+    
+    // Pull mode: resolves with the next frame, or null once stopped
+    Napi::Promise Next(Napi::Env env);
+
+private:
+    // A captured frame tagged with its capture order, so delivery can
+    // interleave the per-type queues the way the frames arrived
+    struct QueuedFrame {
+        uint64_t sequence;
+        CapturedFrame frame;
+    };
+    
+    typedef std::unique_ptr<QueuedFrame> QueuedFramePtr;
+    
+    struct FrameQueue {
+        NdiRingBuffer<QueuedFramePtr> ring;
+        std::atomic<uint64_t> enqueued;
+        std::atomic<uint64_t> dropped;
+        std::atomic<size_t> highWaterMark;
+        
+        explicit FrameQueue(size_t depth) : ring(depth), enqueued(0), dropped(0), highWaterMark(0) {}
+    };
+    
+    // State shared with deliveries still pending on the event loop
+    struct Shared {
+        FrameQueue video;
+        FrameQueue audio;
+        FrameQueue metadata;
+        std::atomic<bool> wakePending;
+        bool pull;
+        
+        // Pull mode promises waiting for a frame, JavaScript thread only
+        std::deque<Napi::Promise::Deferred> waiters;
+        
+        // Only guards pausing, stopping and waits under the Block policy
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool paused;
+        bool stopping;
+        
+        Shared(const Options& options, bool pull)
+            : video(options.videoDepth),
+              audio(options.audioDepth),
+              metadata(options.metadataDepth),
+              wakePending(false),
+              pull(pull),
+              paused(false),
+              stopping(false) {}
+        
+        FrameQueue& QueueFor(NDIlib_frame_type_e type);
+    };
+    
+    void Run();
+    bool Enqueue(FrameQueue& queue, QueuedFramePtr& frame);
+    static void Deliver(Napi::Env env, Napi::Function callback, const std::shared_ptr<Shared>& shared);
+    static void ResolveWaiters(Napi::Env env, const std::shared_ptr<Shared>& shared);
+    static void WakeProducer(const std::shared_ptr<Shared>& shared);
+    
+    RecvHandle m_receiver;
+    Options m_options;
+    VideoCaptureOptions m_videoOptions;
+    Napi::ThreadSafeFunction m_tsfn;
+    std::shared_ptr<Shared> m_shared;
+    std::thread m_thread;
+};
+
+#endif // NDI_CAPTURE_THREAD_H
@@ -0,0 +1,1550 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Convert - Implementation
+ */
+
+#include "ndi_convert.h"
+#include "ndi_frame_pool.h"
+#include "ndi_executor.h"
+#include <string>
+#include <vector>
+
+// SSE2 is part of x86-64; AVX2 is compiled per function and picked at runtime
+#if defined(__x86_64__) || defined(_M_X64)
+#define NDI_CONVERT_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define NDI_TARGET_AVX2
+#else
+#define NDI_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define NDI_CONVERT_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace NdiConvert {
+
+namespace {
+
+// BT.709 limited range in fixed point. Every kernel does exactly the integer
+// arithmetic of the scalar reference, so SIMD output matches it bit for bit.
+
+// YUV -> RGB works in 16 bits with 6 fractional bits, so a vector holds twice
+// as many pixels. Samples are taken as Y * 256 and (C - 128) * 256, and the
+// coefficients below are scaled for the high half of a 16 x 16 multiply.
+const int kFracBits = 6;
+const int kYScale = 19077;      // 1.164384 * 64 * 256
+const int kYBias = 1160;        // 16 * 1.164384 * 64, less 32 to round
+const int kVToR = 29372;        // 1.792741 * 16384
+const int kUToG = 3494;         // 0.213249 * 16384
+const int kVToG = 8731;         // 0.532909 * 16384
+const int kUToB = 1842;         // (2.112402 - 2) * 16384, the 2 is a shift
+
+// RGB -> YUV works in 32 bits with 13 fractional bits. Chroma is taken from
+// the sum of a pixel pair, so it is shifted by one more bit.
+const int kShift = 13;
+const int kRound = 1 << (kShift - 1);
+const int kRToY = 1496;         // 0.182586
+const int kGToY = 5032;         // 0.614231
+const int kBToY = 508;          // 0.062007
+const int kRToU = -824;         // -0.100644
+const int kGToU = -2774;        // -0.338572
+const int kBToU = 3598;         // 0.439216
+const int kRToV = 3598;         // 0.439216
+const int kGToV = -3268;        // -0.398942
+const int kBToV = -330;         // -0.040274
+const int kChromaShift = kShift + 1;
+const int kChromaRound = 1 << (kChromaShift - 1);
+
+// 16-bit samples lose their low byte after adding a threshold from one row of
+// a 4x4 ordered dither matrix, repeating along the line; without dithering
+// every threshold is 128, which rounds to nearest
+const uint16_t kDither[4][4] = {
+    { 8, 136, 40, 168 },
+    { 200, 72, 232, 104 },
+    { 56, 184, 24, 152 },
+    { 248, 120, 216, 88 }
+};
+const uint16_t kNoDither[4] = { 128, 128, 128, 128 };
+
+// 16-bit samples unpack to floats in 0..1
+const float kUnorm16Scale = 1.0f / 65535.0f;
+
+// Converts one line of width pixels; width is always even
+typedef void (*RowKernel)(const uint8_t* src, uint8_t* dst, int width);
+
+// Interleaves a line of 4:2:0 luma with its chroma line into UYVY. uvStep is
+// 1 for separate U and V planes and 2 for NV12's interleaved one (v = u + 1).
+typedef void (*PlanarToUyvyKernel)(
+    const uint8_t* y, const uint8_t* u, const uint8_t* v, int uvStep, uint8_t* dst, int width);
+
+// Splits a pair of UYVY lines into two luma lines and one chroma line holding
+// the rounded average of the pair, which is how 4:2:2 becomes 4:2:0
+typedef void (*UyvyToPlanarKernel)(
+    const uint8_t* src0, const uint8_t* src1, uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v, int uvStep, int width);
+
+// Narrows a line of P216 (16-bit luma and interleaved 16-bit 4:2:2 chroma)
+// to UYVY; dither is one row of thresholds, see kDither
+typedef void (*P216ToUyvyKernel)(const uint16_t* y, const uint16_t* uv, const uint16_t* dither, uint8_t* dst, int width);
+
+// Narrows a line of 16-bit alpha into the alpha bytes of 4-byte pixels
+typedef void (*AlphaToRgbKernel)(const uint16_t* alpha, const uint16_t* dither, uint8_t* dst, int width);
+
+// Unpacks count 16-bit samples to floats in 0..1
+typedef void (*Unorm16ToFloatKernel)(const uint16_t* src, float* dst, int count);
+
+// Unpacks pairs of interleaved 16-bit U/V samples into separate float U and V lines
+typedef void (*SplitUnorm16ToFloatKernel)(const uint16_t* uv, float* u, float* v, int pairs);
+
+struct Kernels {
+    const char* name;
+    RowKernel uyvyToBgra;
+    RowKernel uyvyToRgba;
+    RowKernel bgraToUyvy;
+    RowKernel rgbaToUyvy;
+    PlanarToUyvyKernel planarToUyvy;
+    UyvyToPlanarKernel uyvyToPlanar;
+    P216ToUyvyKernel p216ToUyvy;
+    AlphaToRgbKernel alphaToRgb;
+    Unorm16ToFloatKernel unorm16ToFloat;
+    SplitUnorm16ToFloatKernel splitUnorm16ToFloat;
+};
+
+// x + threshold saturated to 16 bits, then its high byte, like paddusw
+inline uint8_t Narrow16(uint16_t x, uint16_t threshold) {
+    int sum = x + threshold;
+    return static_cast<uint8_t>((sum > 0xFFFF ? 0xFFFF : sum) >> 8);
+}
+
+inline uint8_t Clamp8(int value) {
+    return static_cast<uint8_t>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+// ============================================================================
+// Scalar reference
+// ============================================================================
+
+// kR / kB are the byte offsets of red and blue in a 4-byte pixel
+template <int kR, int kB>
+void UyvyToRgbRowScalar(const uint8_t* src, uint8_t* dst, int width) {
+    for (int x = 0; x < width; x += 2, src += 4, dst += 8) {
+        int u = (src[0] - 128) * 256;
+        int v = (src[2] - 128) * 256;
+        int y0 = ((src[1] * 256 * kYScale) >> 16) - kYBias;
+        int y1 = ((src[3] * 256 * kYScale) >> 16) - kYBias;
+        
+        int r = (v * kVToR) >> 16;
+        int g = ((u * kUToG) >> 16) + ((v * kVToG) >> 16);
+        int b = (u >> 1) + ((u * kUToB) >> 16);
+        
+        // The SIMD kernels saturate at 16 bits first, which clamps the same way
+        dst[kR] = Clamp8((y0 + r) >> kFracBits);
+        dst[1] = Clamp8((y0 - g) >> kFracBits);
+        dst[kB] = Clamp8((y0 + b) >> kFracBits);
+        dst[3] = 255;
+        dst[4 + kR] = Clamp8((y1 + r) >> kFracBits);
+        dst[5] = Clamp8((y1 - g) >> kFracBits);
+        dst[4 + kB] = Clamp8((y1 + b) >> kFracBits);
+        dst[7] = 255;
+    }
+}
+
+template <int kR, int kB>
+void RgbToUyvyRowScalar(const uint8_t* src, uint8_t* dst, int width) {
+    for (int x = 0; x < width; x += 2, src += 8, dst += 4) {
+        int r0 = src[kR], g0 = src[1], b0 = src[kB];
+        int r1 = src[4 + kR], g1 = src[5], b1 = src[4 + kB];
+        int r = r0 + r1, g = g0 + g1, b = b0 + b1;
+        
+        dst[0] = Clamp8(((kRToU * r + kGToU * g + kBToU * b + kChromaRound) >> kChromaShift) + 128);
+        dst[1] = Clamp8(((kRToY * r0 + kGToY * g0 + kBToY * b0 + kRound) >> kShift) + 16);
+        dst[2] = Clamp8(((kRToV * r + kGToV * g + kBToV * b + kChromaRound) >> kChromaShift) + 128);
+        dst[3] = Clamp8(((kRToY * r1 + kGToY * g1 + kBToY * b1 + kRound) >> kShift) + 16);
+    }
+}
+
+void PlanarToUyvyRowScalar(const uint8_t* y, const uint8_t* u, const uint8_t* v, int uvStep, uint8_t* dst, int width) {
+    for (int x = 0; x < width; x += 2, y += 2, u += uvStep, v += uvStep, dst += 4) {
+        dst[0] = *u;
+        dst[1] = y[0];
+        dst[2] = *v;
+        dst[3] = y[1];
+    }
+}
+
+void UyvyToPlanarRowScalar(
+    const uint8_t* src0, const uint8_t* src1, uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v, int uvStep, int width) {
+    for (int x = 0; x < width; x += 2, src0 += 4, src1 += 4, y0 += 2, y1 += 2, u += uvStep, v += uvStep) {
+        y0[0] = src0[1];
+        y0[1] = src0[3];
+        y1[0] = src1[1];
+        y1[1] = src1[3];
+        *u = static_cast<uint8_t>((src0[0] + src1[0] + 1) >> 1);
+        *v = static_cast<uint8_t>((src0[2] + src1[2] + 1) >> 1);
+    }
+}
+
+// Tails of the SIMD kernels start at a multiple of 8 pixels, so the dither
+// phase (x & 3) carries on unbroken
+void P216ToUyvyRowScalar(const uint16_t* y, const uint16_t* uv, const uint16_t* dither, uint8_t* dst, int width) {
+    for (int x = 0; x < width; x += 2, dst += 4) {
+        dst[0] = Narrow16(uv[x], dither[x & 3]);
+        dst[1] = Narrow16(y[x], dither[x & 3]);
+        dst[2] = Narrow16(uv[x + 1], dither[(x + 1) & 3]);
+        dst[3] = Narrow16(y[x + 1], dither[(x + 1) & 3]);
+    }
+}
+
+void AlphaToRgbRowScalar(const uint16_t* alpha, const uint16_t* dither, uint8_t* dst, int width) {
+    for (int x = 0; x < width; x++) {
+        dst[x * 4 + 3] = Narrow16(alpha[x], dither[x & 3]);
+    }
+}
+
+void Unorm16ToFloatScalar(const uint16_t* src, float* dst, int count) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = static_cast<float>(src[i]) * kUnorm16Scale;
+    }
+}
+
+void SplitUnorm16ToFloatScalar(const uint16_t* uv, float* u, float* v, int pairs) {
+    for (int i = 0; i < pairs; i++) {
+        u[i] = static_cast<float>(uv[i * 2]) * kUnorm16Scale;
+        v[i] = static_cast<float>(uv[i * 2 + 1]) * kUnorm16Scale;
+    }
+}
+
+const Kernels kScalarKernels = {
+    "scalar",
+    UyvyToRgbRowScalar<2, 0>,
+    UyvyToRgbRowScalar<0, 2>,
+    RgbToUyvyRowScalar<2, 0>,
+    RgbToUyvyRowScalar<0, 2>,
+    PlanarToUyvyRowScalar,
+    UyvyToPlanarRowScalar,
+    P216ToUyvyRowScalar,
+    AlphaToRgbRowScalar,
+    Unorm16ToFloatScalar,
+    SplitUnorm16ToFloatScalar
+};
+
+#if NDI_CONVERT_X86
+
+// ============================================================================
+// SSE2
+// ============================================================================
+
+/**
+ * R, G and B as 16-bit lanes for the 8 pixels in 16 bytes of UYVY. Luma is
+ * the high byte of each 16-bit lane and chroma the low byte; word shuffles
+ * give both pixels of a pair its U and V.
+ */
+inline void UyvyToRgbSse2(__m128i uyvy, __m128i& r, __m128i& g, __m128i& b) {
+    __m128i y = _mm_and_si128(uyvy, _mm_set1_epi16(static_cast<short>(0xFF00)));
+    y = _mm_sub_epi16(_mm_mulhi_epu16(y, _mm_set1_epi16(static_cast<short>(kYScale))), _mm_set1_epi16(kYBias));
+    
+    __m128i uv = _mm_xor_si128(_mm_slli_epi16(uyvy, 8), _mm_set1_epi16(-32768));
+    __m128i u = _mm_shufflehi_epi16(_mm_shufflelo_epi16(uv, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 2, 0, 0));
+    __m128i v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(uv, _MM_SHUFFLE(3, 3, 1, 1)), _MM_SHUFFLE(3, 3, 1, 1));
+    
+    __m128i rc = _mm_mulhi_epi16(v, _mm_set1_epi16(kVToR));
+    __m128i gc = _mm_add_epi16(_mm_mulhi_epi16(u, _mm_set1_epi16(kUToG)), _mm_mulhi_epi16(v, _mm_set1_epi16(kVToG)));
+    __m128i bc = _mm_add_epi16(_mm_srai_epi16(u, 1), _mm_mulhi_epi16(u, _mm_set1_epi16(kUToB)));
+    
+    r = _mm_srai_epi16(_mm_adds_epi16(y, rc), kFracBits);
+    g = _mm_srai_epi16(_mm_subs_epi16(y, gc), kFracBits);
+    b = _mm_srai_epi16(_mm_adds_epi16(y, bc), kFracBits);
+}
+
+template <bool kRgba>
+void UyvyToRgbRowSse2(const uint8_t* src, uint8_t* dst, int width) {
+    const __m128i alpha = _mm_set1_epi16(255);
+    
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        __m128i r, g, b;
+        UyvyToRgbSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 2)), r, g, b);
+        
+        // Saturate to bytes, then interleave into 4-byte pixels
+        __m128i first = kRgba ? _mm_packus_epi16(r, b) : _mm_packus_epi16(b, r);
+        __m128i ga = _mm_packus_epi16(g, alpha);
+        __m128i low = _mm_unpacklo_epi8(first, ga);
+        __m128i high = _mm_unpackhi_epi8(first, ga);
+        
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 4), _mm_unpacklo_epi16(low, high));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 4 + 16), _mm_unpackhi_epi16(low, high));
+    }
+    
+    UyvyToRgbRowScalar<kRgba ? 0 : 2, kRgba ? 2 : 0>(src + x * 2, dst + x * 4, width - x);
+}
+
+/**
+ * Luma of both pixels and chroma of the pair in pixels: 16-bit lanes holding
+ * two 4-byte pixels. Results come back as [Y0 Y0 Y1 Y1] and [U U V V] sums,
+ * before rounding.
+ */
+inline void RgbToYuvSse2(__m128i pixels, __m128i toY, __m128i toUV, __m128i& y, __m128i& uv) {
+    y = _mm_madd_epi16(pixels, toY);
+    y = _mm_add_epi32(y, _mm_shuffle_epi32(y, _MM_SHUFFLE(2, 3, 0, 1)));
+    
+    __m128i sum = _mm_add_epi16(pixels, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(1, 0, 3, 2)));
+    uv = _mm_madd_epi16(sum, toUV);
+    uv = _mm_add_epi32(uv, _mm_shuffle_epi32(uv, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+// Every other 32-bit lane of a and b: [a0 a2 b0 b2]
+inline __m128i EvenLanesSse2(__m128i a, __m128i b) {
+    return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+/**
+ * 4 pixels from each of p0 and p1 -> 8 pixels of UYVY
+ */
+inline __m128i RgbToUyvy8Sse2(__m128i p0, __m128i p1, __m128i toY, __m128i toUV) {
+    const __m128i zero = _mm_setzero_si128();
+    
+    __m128i y0, uv0, y1, uv1, y2, uv2, y3, uv3;
+    RgbToYuvSse2(_mm_unpacklo_epi8(p0, zero), toY, toUV, y0, uv0);
+    RgbToYuvSse2(_mm_unpackhi_epi8(p0, zero), toY, toUV, y1, uv1);
+    RgbToYuvSse2(_mm_unpacklo_epi8(p1, zero), toY, toUV, y2, uv2);
+    RgbToYuvSse2(_mm_unpackhi_epi8(p1, zero), toY, toUV, y3, uv3);
+    
+    const __m128i yRound = _mm_set1_epi32(kRound);
+    const __m128i yOffset = _mm_set1_epi32(16);
+    const __m128i uvRound = _mm_set1_epi32(kChromaRound);
+    const __m128i uvOffset = _mm_set1_epi32(128);
+    
+    __m128i yLow = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(EvenLanesSse2(y0, y1), yRound), kShift), yOffset);
+    __m128i yHigh = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(EvenLanesSse2(y2, y3), yRound), kShift), yOffset);
+    __m128i uvLow = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(EvenLanesSse2(uv0, uv1), uvRound), kChromaShift), uvOffset);
+    __m128i uvHigh = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(EvenLanesSse2(uv2, uv3), uvRound), kChromaShift), uvOffset);
+    
+    // [U0 V0 U1 V1 ...] interleaved with [Y0 Y1 Y2 Y3 ...] is UYVY order
+    __m128i y = _mm_packs_epi32(yLow, yHigh);
+    __m128i uv = _mm_packs_epi32(uvLow, uvHigh);
+    return _mm_packus_epi16(_mm_unpacklo_epi16(uv, y), _mm_unpackhi_epi16(uv, y));
+}
+
+template <bool kRgba>
+void RgbToUyvyRowSse2(const uint8_t* src, uint8_t* dst, int width) {
+    const __m128i toY = kRgba
+        ? _mm_setr_epi16(kRToY, kGToY, kBToY, 0, kRToY, kGToY, kBToY, 0)
+        : _mm_setr_epi16(kBToY, kGToY, kRToY, 0, kBToY, kGToY, kRToY, 0);
+    const __m128i toUV = kRgba
+        ? _mm_setr_epi16(kRToU, kGToU, kBToU, 0, kRToV, kGToV, kBToV, 0)
+        : _mm_setr_epi16(kBToU, kGToU, kRToU, 0, kBToV, kGToV, kRToV, 0);
+    
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        __m128i p0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 4));
+        __m128i p1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 4 + 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 2), RgbToUyvy8Sse2(p0, p1, toY, toUV));
+    }
+    
+    RgbToUyvyRowScalar<kRgba ? 0 : 2, kRgba ? 2 : 0>(src + x * 4, dst + x * 2, width - x);
+}
+
+void PlanarToUyvyRowSse2(const uint8_t* y, const uint8_t* u, const uint8_t* v, int uvStep, uint8_t* dst, int width) {
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m128i uv;
+        if (uvStep == 2) {
+            uv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u + x));
+        } else {
+            uv = _mm_unpacklo_epi8(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(u + x / 2)),
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + x / 2)));
+        }
+        
+        // [U0 V0 U1 V1 ...] interleaved with [Y0 Y1 Y2 Y3 ...] is UYVY order
+        __m128i luma = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + x));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 2), _mm_unpacklo_epi8(uv, luma));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 2 + 16), _mm_unpackhi_epi8(uv, luma));
+    }
+    
+    PlanarToUyvyRowScalar(y + x, u + x / 2 * uvStep, v + x / 2 * uvStep, uvStep, dst + x * 2, width - x);
+}
+
+void UyvyToPlanarRowSse2(
+    const uint8_t* src0, const uint8_t* src1, uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v, int uvStep, int width) {
+    const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+    const __m128i zero = _mm_setzero_si128();
+    
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src0 + x * 2));
+        __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src0 + x * 2 + 16));
+        __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src1 + x * 2));
+        __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src1 + x * 2 + 16));
+        
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(y0 + x),
+            _mm_packus_epi16(_mm_srli_epi16(a0, 8), _mm_srli_epi16(a1, 8)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(y1 + x),
+            _mm_packus_epi16(_mm_srli_epi16(b0, 8), _mm_srli_epi16(b1, 8)));
+        
+        // pavgb rounds up, (a + b + 1) >> 1, like the scalar kernel
+        __m128i uv = _mm_avg_epu8(
+            _mm_packus_epi16(_mm_and_si128(a0, lowBytes), _mm_and_si128(a1, lowBytes)),
+            _mm_packus_epi16(_mm_and_si128(b0, lowBytes), _mm_and_si128(b1, lowBytes)));
+        
+        if (uvStep == 2) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(u + x), uv);
+        } else {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(u + x / 2), _mm_packus_epi16(_mm_and_si128(uv, lowBytes), zero));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(v + x / 2), _mm_packus_epi16(_mm_srli_epi16(uv, 8), zero));
+        }
+    }
+    
+    UyvyToPlanarRowScalar(src0 + x * 2, src1 + x * 2, y0 + x, y1 + x,
+                          u + x / 2 * uvStep, v + x / 2 * uvStep, uvStep, width - x);
+}
+
+// The dither row for 8 consecutive 16-bit samples starting at a multiple of 4
+inline __m128i DitherSse2(const uint16_t* dither) {
+    return _mm_setr_epi16(
+        static_cast<short>(dither[0]), static_cast<short>(dither[1]),
+        static_cast<short>(dither[2]), static_cast<short>(dither[3]),
+        static_cast<short>(dither[0]), static_cast<short>(dither[1]),
+        static_cast<short>(dither[2]), static_cast<short>(dither[3]));
+}
+
+void P216ToUyvyRowSse2(const uint16_t* y, const uint16_t* uv, const uint16_t* dither, uint8_t* dst, int width) {
+    const __m128i threshold = DitherSse2(dither);
+    
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        __m128i luma = _mm_srli_epi16(_mm_adds_epu16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(y + x)), threshold), 8);
+        __m128i chroma = _mm_srli_epi16(_mm_adds_epu16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(uv + x)), threshold), 8);
+        
+        // Chroma in the low byte and luma in the high byte of each 16-bit lane is UYVY order
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 2), _mm_or_si128(chroma, _mm_slli_epi16(luma, 8)));
+    }
+    
+    P216ToUyvyRowScalar(y + x, uv + x, dither, dst + x * 2, width - x);
+}
+
+void AlphaToRgbRowSse2(const uint16_t* alpha, const uint16_t* dither, uint8_t* dst, int width) {
+    const __m128i threshold = DitherSse2(dither);
+    const __m128i colour = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i zero = _mm_setzero_si128();
+    
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        __m128i a = _mm_srli_epi16(_mm_adds_epu16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(alpha + x)), threshold), 8);
+        
+        // Alpha into the top byte of each 32-bit pixel
+        __m128i low = _mm_slli_epi32(_mm_unpacklo_epi16(a, zero), 24);
+        __m128i high = _mm_slli_epi32(_mm_unpackhi_epi16(a, zero), 24);
+        
+        __m128i* out = reinterpret_cast<__m128i*>(dst + x * 4);
+        _mm_storeu_si128(out, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(out), colour), low));
+        _mm_storeu_si128(out + 1, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(out + 1), colour), high));
+    }
+    
+    AlphaToRgbRowScalar(alpha + x, dither, dst + x * 4, width - x);
+}
+
+void Unorm16ToFloatSse2(const uint16_t* src, float* dst, int count) {
+    const __m128 scale = _mm_set1_ps(kUnorm16Scale);
+    const __m128i zero = _mm_setzero_si128();
+    
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(samples, zero)), scale));
+        _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(samples, zero)), scale));
+    }
+    
+    Unorm16ToFloatScalar(src + i, dst + i, count - i);
+}
+
+void SplitUnorm16ToFloatSse2(const uint16_t* uv, float* u, float* v, int pairs) {
+    const __m128 scale = _mm_set1_ps(kUnorm16Scale);
+    const __m128i lowHalf = _mm_set1_epi32(0xFFFF);
+    
+    int i = 0;
+    for (; i + 4 <= pairs; i += 4) {
+        __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(uv + i * 2));
+        _mm_storeu_ps(u + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(samples, lowHalf)), scale));
+        _mm_storeu_ps(v + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(samples, 16)), scale));
+    }
+    
+    SplitUnorm16ToFloatScalar(uv + i * 2, u + i, v + i, pairs - i);
+}
+
+const Kernels kSse2Kernels = {
+    "sse2",
+    UyvyToRgbRowSse2<false>,
+    UyvyToRgbRowSse2<true>,
+    RgbToUyvyRowSse2<false>,
+    RgbToUyvyRowSse2<true>,
+    PlanarToUyvyRowSse2,
+    UyvyToPlanarRowSse2,
+    P216ToUyvyRowSse2,
+    AlphaToRgbRowSse2,
+    Unorm16ToFloatSse2,
+    SplitUnorm16ToFloatSse2
+};
+
+// ============================================================================
+// AVX2 - the SSE2 kernels on two 128-bit lanes at once
+// ============================================================================
+
+NDI_TARGET_AVX2 inline void UyvyToRgbAvx2(__m256i uyvy, __m256i& r, __m256i& g, __m256i& b) {
+    __m256i y = _mm256_and_si256(uyvy, _mm256_set1_epi16(static_cast<short>(0xFF00)));
+    y = _mm256_sub_epi16(_mm256_mulhi_epu16(y, _mm256_set1_epi16(static_cast<short>(kYScale))), _mm256_set1_epi16(kYBias));
+    
+    __m256i uv = _mm256_xor_si256(_mm256_slli_epi16(uyvy, 8), _mm256_set1_epi16(-32768));
+    __m256i u = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(uv, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 2, 0, 0));
+    __m256i v = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(uv, _MM_SHUFFLE(3, 3, 1, 1)), _MM_SHUFFLE(3, 3, 1, 1));
+    
+    __m256i rc = _mm256_mulhi_epi16(v, _mm256_set1_epi16(kVToR));
+    __m256i gc = _mm256_add_epi16(_mm256_mulhi_epi16(u, _mm256_set1_epi16(kUToG)), _mm256_mulhi_epi16(v, _mm256_set1_epi16(kVToG)));
+    __m256i bc = _mm256_add_epi16(_mm256_srai_epi16(u, 1), _mm256_mulhi_epi16(u, _mm256_set1_epi16(kUToB)));
+    
+    r = _mm256_srai_epi16(_mm256_adds_epi16(y, rc), kFracBits);
+    g = _mm256_srai_epi16(_mm256_subs_epi16(y, gc), kFracBits);
+    b = _mm256_srai_epi16(_mm256_adds_epi16(y, bc), kFracBits);
+}
+
+template <bool kRgba>
+NDI_TARGET_AVX2 void UyvyToRgbRowAvx2(const uint8_t* src, uint8_t* dst, int width) {
+    const __m256i alpha = _mm256_set1_epi16(255);
+    
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        // Pixels 0-3 and 8-11 in lane 0, 4-7 and 12-15 in lane 1, so the
+        // per-lane unpacks at the end come out in line order
+        __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + x * 2));
+        in = _mm256_permute4x64_epi64(in, _MM_SHUFFLE(3, 1, 2, 0));
+        
+        __m256i r, g, b;
+        UyvyToRgbAvx2(in, r, g, b);
+        
+        __m256i first = kRgba ? _mm256_packus_epi16(r, b) : _mm256_packus_epi16(b, r);
+        __m256i ga = _mm256_packus_epi16(g, alpha);
+        __m256i low = _mm256_unpacklo_epi8(first, ga);
+        __m256i high = _mm256_unpackhi_epi8(first, ga);
+        
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x * 4), _mm256_unpacklo_epi16(low, high));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x * 4 + 32), _mm256_unpackhi_epi16(low, high));
+    }
+    
+    UyvyToRgbRowSse2<kRgba>(src + x * 2, dst + x * 4, width - x);
+}
+
+NDI_TARGET_AVX2 inline void RgbToYuvAvx2(__m256i pixels, __m256i toY, __m256i toUV, __m256i& y, __m256i& uv) {
+    y = _mm256_madd_epi16(pixels, toY);
+    y = _mm256_add_epi32(y, _mm256_shuffle_epi32(y, _MM_SHUFFLE(2, 3, 0, 1)));
+    
+    __m256i sum = _mm256_add_epi16(pixels, _mm256_shuffle_epi32(pixels, _MM_SHUFFLE(1, 0, 3, 2)));
+    uv = _mm256_madd_epi16(sum, toUV);
+    uv = _mm256_add_epi32(uv, _mm256_shuffle_epi32(uv, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+NDI_TARGET_AVX2 inline __m256i EvenLanesAvx2(__m256i a, __m256i b) {
+    return _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+template <bool kRgba>
+NDI_TARGET_AVX2 void RgbToUyvyRowAvx2(const uint8_t* src, uint8_t* dst, int width) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i toY = kRgba
+        ? _mm256_setr_epi16(kRToY, kGToY, kBToY, 0, kRToY, kGToY, kBToY, 0, kRToY, kGToY, kBToY, 0, kRToY, kGToY, kBToY, 0)
+        : _mm256_setr_epi16(kBToY, kGToY, kRToY, 0, kBToY, kGToY, kRToY, 0, kBToY, kGToY, kRToY, 0, kBToY, kGToY, kRToY, 0);
+    const __m256i toUV = kRgba
+        ? _mm256_setr_epi16(kRToU, kGToU, kBToU, 0, kRToV, kGToV, kBToV, 0, kRToU, kGToU, kBToU, 0, kRToV, kGToV, kBToV, 0)
+        : _mm256_setr_epi16(kBToU, kGToU, kRToU, 0, kBToV, kGToV, kRToV, 0, kBToU, kGToU, kRToU, 0, kBToV, kGToV, kRToV, 0);
+    const __m256i yRound = _mm256_set1_epi32(kRound);
+    const __m256i yOffset = _mm256_set1_epi32(16);
+    const __m256i uvRound = _mm256_set1_epi32(kChromaRound);
+    const __m256i uvOffset = _mm256_set1_epi32(128);
+    
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m256i in0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + x * 4));
+        __m256i in1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + x * 4 + 32));
+        
+        // Regroup so lane 0 sees pixels 0-7 and lane 1 pixels 8-15
+        __m256i p0 = _mm256_permute2x128_si256(in0, in1, 0x20);
+        __m256i p1 = _mm256_permute2x128_si256(in0, in1, 0x31);
+        
+        __m256i y0, uv0, y1, uv1, y2, uv2, y3, uv3;
+        RgbToYuvAvx2(_mm256_unpacklo_epi8(p0, zero), toY, toUV, y0, uv0);
+        RgbToYuvAvx2(_mm256_unpackhi_epi8(p0, zero), toY, toUV, y1, uv1);
+        RgbToYuvAvx2(_mm256_unpacklo_epi8(p1, zero), toY, toUV, y2, uv2);
+        RgbToYuvAvx2(_mm256_unpackhi_epi8(p1, zero), toY, toUV, y3, uv3);
+        
+        __m256i yLow = _mm256_add_epi32(_mm256_srai_epi32(_mm256_add_epi32(EvenLanesAvx2(y0, y1), yRound), kShift), yOffset);
+        __m256i yHigh = _mm256_add_epi32(_mm256_srai_epi32(_mm256_add_epi32(EvenLanesAvx2(y2, y3), yRound), kShift), yOffset);
+        __m256i uvLow = _mm256_add_epi32(_mm256_srai_epi32(_mm256_add_epi32(EvenLanesAvx2(uv0, uv1), uvRound), kChromaShift), uvOffset);
+        __m256i uvHigh = _mm256_add_epi32(_mm256_srai_epi32(_mm256_add_epi32(EvenLanesAvx2(uv2, uv3), uvRound), kChromaShift), uvOffset);
+        
+        __m256i y = _mm256_packs_epi32(yLow, yHigh);
+        __m256i uv = _mm256_packs_epi32(uvLow, uvHigh);
+        __m256i out = _mm256_packus_epi16(_mm256_unpacklo_epi16(uv, y), _mm256_unpackhi_epi16(uv, y));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x * 2), out);
+    }
+    
+    RgbToUyvyRowSse2<kRgba>(src + x * 4, dst + x * 2, width - x);
+}
+
+// The planar and 16-bit kernels do little more than move data and are bound
+// by loads and stores, so the SSE2 ones serve here too
+const Kernels kAvx2Kernels = {
+    "avx2",
+    UyvyToRgbRowAvx2<false>,
+    UyvyToRgbRowAvx2<true>,
+    RgbToUyvyRowAvx2<false>,
+    RgbToUyvyRowAvx2<true>,
+    PlanarToUyvyRowSse2,
+    UyvyToPlanarRowSse2,
+    P216ToUyvyRowSse2,
+    AlphaToRgbRowSse2,
+    Unorm16ToFloatSse2,
+    SplitUnorm16ToFloatSse2
+};
+
+bool CpuHasAvx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    
+    // The OS must also save the YMM registers across context switches
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+    
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif // NDI_CONVERT_X86
+
+#if NDI_CONVERT_NEON
+
+// ============================================================================
+// NEON
+// ============================================================================
+
+// Y * 256 * kYScale >> 16, less the bias, for 8 luma samples
+inline int16x8_t LumaTermNeon(uint8x8_t y) {
+    uint16x8_t y16 = vmovl_u8(y);
+    uint16x4_t low = vshrn_n_u32(vmull_n_u16(vget_low_u16(y16), kYScale), 8);
+    uint16x4_t high = vshrn_n_u32(vmull_n_u16(vget_high_u16(y16), kYScale), 8);
+    return vsubq_s16(vreinterpretq_s16_u16(vcombine_u16(low, high)), vdupq_n_s16(kYBias));
+}
+
+template <bool kRgba>
+void UyvyToRgbRowNeon(const uint8_t* src, uint8_t* dst, int width) {
+    const uint8x8_t alpha = vdup_n_u8(255);
+    
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        // U, even Y, V and odd Y of 16 pixels
+        uint8x8x4_t in = vld4_u8(src + x * 2);
+        int16x8_t yEven = LumaTermNeon(in.val[1]);
+        int16x8_t yOdd = LumaTermNeon(in.val[3]);
+        
+        // (C - 128) * 128; the doubling multiply makes up the missing bit
+        int16x8_t u = vshlq_n_s16(vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(in.val[0])), vdupq_n_s16(128)), 7);
+        int16x8_t v = vshlq_n_s16(vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(in.val[2])), vdupq_n_s16(128)), 7);
+        
+        int16x8_t rc = vqdmulhq_n_s16(v, kVToR);
+        int16x8_t gc = vaddq_s16(vqdmulhq_n_s16(u, kUToG), vqdmulhq_n_s16(v, kVToG));
+        int16x8_t bc = vaddq_s16(u, vqdmulhq_n_s16(u, kUToB));
+        
+        // Zip even and odd pixels back into line order
+        uint8x8x2_t r = vzip_u8(
+            vqmovun_s16(vshrq_n_s16(vqaddq_s16(yEven, rc), kFracBits)),
+            vqmovun_s16(vshrq_n_s16(vqaddq_s16(yOdd, rc), kFracBits)));
+        uint8x8x2_t g = vzip_u8(
+            vqmovun_s16(vshrq_n_s16(vqsubq_s16(yEven, gc), kFracBits)),
+            vqmovun_s16(vshrq_n_s16(vqsubq_s16(yOdd, gc), kFracBits)));
+        uint8x8x2_t b = vzip_u8(
+            vqmovun_s16(vshrq_n_s16(vqaddq_s16(yEven, bc), kFracBits)),
+            vqmovun_s16(vshrq_n_s16(vqaddq_s16(yOdd, bc), kFracBits)));
+        
+        for (int half = 0; half < 2; half++) {
+            uint8x8x4_t out;
+            out.val[kRgba ? 0 : 2] = r.val[half];
+            out.val[1] = g.val[half];
+            out.val[kRgba ? 2 : 0] = b.val[half];
+            out.val[3] = alpha;
+            vst4_u8(dst + x * 4 + half * 32, out);
+        }
+    }
+    
+    UyvyToRgbRowScalar<kRgba ? 0 : 2, kRgba ? 2 : 0>(src + x * 2, dst + x * 4, width - x);
+}
+
+// Weighted sum of 4 pixels' (or pixel pairs') channels, rounded and narrowed
+template <int kShiftBits>
+inline int16x4_t WeightedSumNeon(int16x4_t r, int16x4_t g, int16x4_t b, int16_t toR, int16_t toG, int16_t toB) {
+    int32x4_t sum = vmull_n_s16(r, toR);
+    sum = vmlal_n_s16(sum, g, toG);
+    sum = vmlal_n_s16(sum, b, toB);
+    return vrshrn_n_s32(sum, kShiftBits);
+}
+
+// Luma of 8 pixels
+inline uint8x8_t LumaNeon(uint8x8_t r, uint8x8_t g, uint8x8_t b) {
+    int16x8_t r16 = vreinterpretq_s16_u16(vmovl_u8(r));
+    int16x8_t g16 = vreinterpretq_s16_u16(vmovl_u8(g));
+    int16x8_t b16 = vreinterpretq_s16_u16(vmovl_u8(b));
+    
+    int16x8_t y = vcombine_s16(
+        WeightedSumNeon<kShift>(vget_low_s16(r16), vget_low_s16(g16), vget_low_s16(b16), kRToY, kGToY, kBToY),
+        WeightedSumNeon<kShift>(vget_high_s16(r16), vget_high_s16(g16), vget_high_s16(b16), kRToY, kGToY, kBToY));
+    return vqmovun_s16(vaddq_s16(y, vdupq_n_s16(16)));
+}
+
+// One chroma channel of 8 pixel pairs, from per-pair channel sums
+inline uint8x8_t ChromaNeon(int16x8_t r, int16x8_t g, int16x8_t b, int16_t toR, int16_t toG, int16_t toB) {
+    int16x8_t c = vcombine_s16(
+        WeightedSumNeon<kChromaShift>(vget_low_s16(r), vget_low_s16(g), vget_low_s16(b), toR, toG, toB),
+        WeightedSumNeon<kChromaShift>(vget_high_s16(r), vget_high_s16(g), vget_high_s16(b), toR, toG, toB));
+    return vqmovun_s16(vaddq_s16(c, vdupq_n_s16(128)));
+}
+
+template <bool kRgba>
+void RgbToUyvyRowNeon(const uint8_t* src, uint8_t* dst, int width) {
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        uint8x16x4_t in = vld4q_u8(src + x * 4);
+        uint8x16_t r = in.val[kRgba ? 0 : 2];
+        uint8x16_t g = in.val[1];
+        uint8x16_t b = in.val[kRgba ? 2 : 0];
+        
+        uint8x8x2_t y = vuzp_u8(
+            LumaNeon(vget_low_u8(r), vget_low_u8(g), vget_low_u8(b)),
+            LumaNeon(vget_high_u8(r), vget_high_u8(g), vget_high_u8(b)));
+        
+        // Pairwise add gives the sum of each pixel pair
+        int16x8_t rSum = vreinterpretq_s16_u16(vpaddlq_u8(r));
+        int16x8_t gSum = vreinterpretq_s16_u16(vpaddlq_u8(g));
+        int16x8_t bSum = vreinterpretq_s16_u16(vpaddlq_u8(b));
+        
+        uint8x8x4_t out;
+        out.val[0] = ChromaNeon(rSum, gSum, bSum, kRToU, kGToU, kBToU);
+        out.val[1] = y.val[0];
+        out.val[2] = ChromaNeon(rSum, gSum, bSum, kRToV, kGToV, kBToV);
+        out.val[3] = y.val[1];
+        vst4_u8(dst + x * 2, out);
+    }
+    
+    RgbToUyvyRowScalar<kRgba ? 0 : 2, kRgba ? 2 : 0>(src + x * 4, dst + x * 2, width - x);
+}
+
+void PlanarToUyvyRowNeon(const uint8_t* y, const uint8_t* u, const uint8_t* v, int uvStep, uint8_t* dst, int width) {
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        uint8x8x2_t luma = vld2_u8(y + x);
+        uint8x8x4_t out;
+        
+        if (uvStep == 2) {
+            uint8x8x2_t uv = vld2_u8(u + x);
+            out.val[0] = uv.val[0];
+            out.val[2] = uv.val[1];
+        } else {
+            out.val[0] = vld1_u8(u + x / 2);
+            out.val[2] = vld1_u8(v + x / 2);
+        }
+        
+        out.val[1] = luma.val[0];
+        out.val[3] = luma.val[1];
+        vst4_u8(dst + x * 2, out);
+    }
+    
+    PlanarToUyvyRowScalar(y + x, u + x / 2 * uvStep, v + x / 2 * uvStep, uvStep, dst + x * 2, width - x);
+}
+
+void UyvyToPlanarRowNeon(
+    const uint8_t* src0, const uint8_t* src1, uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v, int uvStep, int width) {
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        uint8x8x4_t a = vld4_u8(src0 + x * 2);
+        uint8x8x4_t b = vld4_u8(src1 + x * 2);
+        
+        uint8x8x2_t lumaA = { { a.val[1], a.val[3] } };
+        uint8x8x2_t lumaB = { { b.val[1], b.val[3] } };
+        vst2_u8(y0 + x, lumaA);
+        vst2_u8(y1 + x, lumaB);
+        
+        // Rounding halving add, (a + b + 1) >> 1 like the scalar kernel
+        uint8x8_t cu = vrhadd_u8(a.val[0], b.val[0]);
+        uint8x8_t cv = vrhadd_u8(a.val[2], b.val[2]);
+        
+        if (uvStep == 2) {
+            uint8x8x2_t uv = { { cu, cv } };
+            vst2_u8(u + x, uv);
+        } else {
+            vst1_u8(u + x / 2, cu);
+            vst1_u8(v + x / 2, cv);
+        }
+    }
+    
+    UyvyToPlanarRowScalar(src0 + x * 2, src1 + x * 2, y0 + x, y1 + x,
+                          u + x / 2 * uvStep, v + x / 2 * uvStep, uvStep, width - x);
+}
+
+// The dither row for 8 consecutive 16-bit samples starting at a multiple of 4
+inline uint16x8_t DitherNeon(const uint16_t* dither) {
+    uint16x4_t row = vld1_u16(dither);
+    return vcombine_u16(row, row);
+}
+
+void P216ToUyvyRowNeon(const uint16_t* y, const uint16_t* uv, const uint16_t* dither, uint8_t* dst, int width) {
+    const uint16x8_t threshold = DitherNeon(dither);
+    
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        uint8x8x2_t out;
+        out.val[0] = vshrn_n_u16(vqaddq_u16(vld1q_u16(uv + x), threshold), 8);
+        out.val[1] = vshrn_n_u16(vqaddq_u16(vld1q_u16(y + x), threshold), 8);
+        vst2_u8(dst + x * 2, out);
+    }
+    
+    P216ToUyvyRowScalar(y + x, uv + x, dither, dst + x * 2, width - x);
+}
+
+void AlphaToRgbRowNeon(const uint16_t* alpha, const uint16_t* dither, uint8_t* dst, int width) {
+    const uint16x8_t threshold = DitherNeon(dither);
+    
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        uint8x8x4_t pixels = vld4_u8(dst + x * 4);
+        pixels.val[3] = vshrn_n_u16(vqaddq_u16(vld1q_u16(alpha + x), threshold), 8);
+        vst4_u8(dst + x * 4, pixels);
+    }
+    
+    AlphaToRgbRowScalar(alpha + x, dither, dst + x * 4, width - x);
+}
+
+void Unorm16ToFloatNeon(const uint16_t* src, float* dst, int count) {
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        uint16x8_t samples = vld1q_u16(src + i);
+        vst1q_f32(dst + i, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(samples))), kUnorm16Scale));
+        vst1q_f32(dst + i + 4, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(samples))), kUnorm16Scale));
+    }
+    
+    Unorm16ToFloatScalar(src + i, dst + i, count - i);
+}
+
+void SplitUnorm16ToFloatNeon(const uint16_t* uv, float* u, float* v, int pairs) {
+    int i = 0;
+    for (; i + 4 <= pairs; i += 4) {
+        uint16x4x2_t samples = vld2_u16(uv + i * 2);
+        vst1q_f32(u + i, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(samples.val[0])), kUnorm16Scale));
+        vst1q_f32(v + i, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(samples.val[1])), kUnorm16Scale));
+    }
+    
+    SplitUnorm16ToFloatScalar(uv + i * 2, u + i, v + i, pairs - i);
+}
+
+const Kernels kNeonKernels = {
+    "neon",
+    UyvyToRgbRowNeon<false>,
+    UyvyToRgbRowNeon<true>,
+    RgbToUyvyRowNeon<false>,
+    RgbToUyvyRowNeon<true>,
+    PlanarToUyvyRowNeon,
+    UyvyToPlanarRowNeon,
+    P216ToUyvyRowNeon,
+    AlphaToRgbRowNeon,
+    Unorm16ToFloatNeon,
+    SplitUnorm16ToFloatNeon
+};
+
+#endif // NDI_CONVERT_NEON
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+
+const Kernels& SelectKernels() {
+#if NDI_CONVERT_X86
+    if (CpuHasAvx2()) {
+        return kAvx2Kernels;
+    }
+    return kSse2Kernels;
+#elif NDI_CONVERT_NEON
+    return kNeonKernels;
+#else
+    return kScalarKernels;
+#endif
+}
+
+// Chosen once; Init() runs this while the addon loads
+const Kernels& ActiveKernels() {
+    static const Kernels& kernels = SelectKernels();
+    return kernels;
+}
+
+bool IsRgb(NDIlib_FourCC_video_type_e fourCC) {
+    return fourCC == NDIlib_FourCC_video_type_BGRA || fourCC == NDIlib_FourCC_video_type_BGRX ||
+           fourCC == NDIlib_FourCC_video_type_RGBA || fourCC == NDIlib_FourCC_video_type_RGBX;
+}
+
+bool IsRedFirst(NDIlib_FourCC_video_type_e fourCC) {
+    return fourCC == NDIlib_FourCC_video_type_RGBA || fourCC == NDIlib_FourCC_video_type_RGBX;
+}
+
+bool IsPlanar(NDIlib_FourCC_video_type_e fourCC) {
+    return fourCC == NDIlib_FourCC_video_type_I420 || fourCC == NDIlib_FourCC_video_type_YV12 ||
+           fourCC == NDIlib_FourCC_video_type_NV12;
+}
+
+bool Is16Bit(NDIlib_FourCC_video_type_e fourCC) {
+    return fourCC == NDIlib_FourCC_video_type_P216 || fourCC == NDIlib_FourCC_video_type_PA16;
+}
+
+bool IsFloat(NDIlib_FourCC_video_type_e fourCC) {
+    return fourCC == NdiUtils::FourCCVideoF216 || fourCC == NdiUtils::FourCCVideoFA16;
+}
+
+bool IsV210(NDIlib_FourCC_video_type_e fourCC) {
+    return fourCC == NdiUtils::FourCCVideoV210;
+}
+
+const uint16_t* DitherRow(bool dither, int line) {
+    return dither ? kDither[line & 3] : kNoDither;
+}
+
+/**
+ * Where the chroma of a 4:2:0 frame lives. NDI keeps all planes in one block
+ * after the luma plane: I420 has U then V at half the luma stride, YV12 the
+ * same with V first, and NV12 one interleaved UV plane at the full stride.
+ */
+struct PlanarLayout {
+    size_t uOffset;
+    size_t vOffset;
+    int chromaStride;
+    int uvStep;
+};
+
+PlanarLayout GetPlanarLayout(NDIlib_FourCC_video_type_e fourCC, int stride, int yres) {
+    PlanarLayout layout;
+    size_t lumaSize = static_cast<size_t>(stride) * yres;
+    
+    if (fourCC == NDIlib_FourCC_video_type_NV12) {
+        layout.uOffset = lumaSize;
+        layout.vOffset = lumaSize + 1;
+        layout.chromaStride = stride;
+        layout.uvStep = 2;
+        return layout;
+    }
+    
+    size_t chromaSize = static_cast<size_t>(stride / 2) * (yres / 2);
+    bool vFirst = fourCC == NDIlib_FourCC_video_type_YV12;
+    layout.uOffset = vFirst ? lumaSize + chromaSize : lumaSize;
+    layout.vOffset = vFirst ? lumaSize : lumaSize + chromaSize;
+    layout.chromaStride = stride / 2;
+    layout.uvStep = 1;
+    return layout;
+}
+
+/**
+ * One line of a UYVY, RGB, planar or 16-bit frame as UYVY. UYVY lines are
+ * returned in place, anything else is converted into out.
+ */
+const uint8_t* LineToUyvy(
+    const Kernels& kernels,
+    NDIlib_FourCC_video_type_e fourCC,
+    const uint8_t* src,
+    int stride,
+    int yres,
+    int line,
+    bool dither,
+    uint8_t* out,
+    int xres
+) {
+    const uint8_t* row = src + static_cast<size_t>(line) * stride;
+    
+    if (fourCC == NDIlib_FourCC_video_type_UYVY) {
+        return row;
+    }
+    
+    if (IsRgb(fourCC)) {
+        (IsRedFirst(fourCC) ? kernels.rgbaToUyvy : kernels.bgraToUyvy)(row, out, xres);
+        return out;
+    }
+    
+    if (Is16Bit(fourCC)) {
+        // The UV plane has the luma plane's size and stride
+        kernels.p216ToUyvy(
+            reinterpret_cast<const uint16_t*>(row),
+            reinterpret_cast<const uint16_t*>(row + static_cast<size_t>(stride) * yres),
+            DitherRow(dither, line),
+            out,
+            xres
+        );
+        return out;
+    }
+    
+    PlanarLayout layout = GetPlanarLayout(fourCC, stride, yres);
+    size_t chroma = static_cast<size_t>(line / 2) * layout.chromaStride;
+    kernels.planarToUyvy(row, src + layout.uOffset + chroma, src + layout.vOffset + chroma, layout.uvStep, out, xres);
+    return out;
+}
+
+/**
+ * Write lines (1 or 2) UYVY lines into an RGB frame, or a pair into a planar
+ * frame, starting at line. UYVY frames were already written by LineToUyvy().
+ */
+void UyvyToLines(
+    const Kernels& kernels,
+    NDIlib_FourCC_video_type_e fourCC,
+    const uint8_t* const uyvy[2],
+    int lines,
+    uint8_t* dst,
+    int stride,
+    int yres,
+    int line,
+    int xres
+) {
+    uint8_t* row0 = dst + static_cast<size_t>(line) * stride;
+    uint8_t* row1 = row0 + stride;
+    
+    if (IsRgb(fourCC)) {
+        RowKernel kernel = IsRedFirst(fourCC) ? kernels.uyvyToRgba : kernels.uyvyToBgra;
+        kernel(uyvy[0], row0, xres);
+        if (lines > 1) {
+            kernel(uyvy[1], row1, xres);
+        }
+    } else if (IsPlanar(fourCC)) {
+        PlanarLayout layout = GetPlanarLayout(fourCC, stride, yres);
+        size_t chroma = static_cast<size_t>(line / 2) * layout.chromaStride;
+        kernels.uyvyToPlanar(uyvy[0], uyvy[1], row0, row1,
+                             dst + layout.uOffset + chroma, dst + layout.vOffset + chroma, layout.uvStep, xres);
+    }
+}
+
+/**
+ * Bytes a frame of this FourCC, size and stride covers, every plane included
+ */
+size_t FrameDataSize(NDIlib_FourCC_video_type_e fourCC, int xres, int yres, int stride) {
+    NDIlib_video_frame_v2_t frame = {};
+    frame.FourCC = fourCC;
+    frame.xres = xres;
+    frame.yres = yres;
+    frame.line_stride_in_bytes = stride;
+    return NdiUtils::VideoFrameDataSize(frame);
+}
+
+/**
+ * Whether a height and stride suit the planes of a FourCC: 4:2:0 frames are
+ * converted a line pair at a time and halve the stride for chroma, 16-bit
+ * lines must hold whole samples, float chroma planes whole floats and V210
+ * lines whole groups of six pixels.
+ */
+bool FitsLayout(NDIlib_FourCC_video_type_e fourCC, int yres, int stride) {
+    if (IsV210(fourCC)) {
+        return (stride & 15) == 0;
+    }
+    if (IsPlanar(fourCC)) {
+        return (yres & 1) == 0 && (stride & 1) == 0;
+    }
+    if (Is16Bit(fourCC)) {
+        return (stride & 1) == 0;
+    }
+    if (IsFloat(fourCC)) {
+        return (stride & 7) == 0;
+    }
+    return true;
+}
+
+/**
+ * P216 / PA16 -> F216 / FA16: every sample as a float in 0..1, chroma split
+ * into U and V planes of half the luma stride
+ */
+void UnpackFloat(
+    const Kernels& kernels,
+    NDIlib_FourCC_video_type_e to,
+    const uint8_t* src,
+    int srcStride,
+    uint8_t* dst,
+    int dstStride,
+    int xres,
+    int yres
+) {
+    size_t srcPlane = static_cast<size_t>(srcStride) * yres;
+    size_t dstPlane = static_cast<size_t>(dstStride) * yres;
+    
+    for (int line = 0; line < yres; line++) {
+        const uint8_t* luma = src + static_cast<size_t>(line) * srcStride;
+        uint8_t* lumaOut = dst + static_cast<size_t>(line) * dstStride;
+        uint8_t* uOut = dst + dstPlane + static_cast<size_t>(line) * (dstStride / 2);
+        
+        kernels.unorm16ToFloat(reinterpret_cast<const uint16_t*>(luma), reinterpret_cast<float*>(lumaOut), xres);
+        kernels.splitUnorm16ToFloat(
+            reinterpret_cast<const uint16_t*>(luma + srcPlane),
+            reinterpret_cast<float*>(uOut),
+            reinterpret_cast<float*>(uOut + dstPlane / 2),
+            xres / 2
+        );
+        
+        if (to == NdiUtils::FourCCVideoFA16) {
+            kernels.unorm16ToFloat(
+                reinterpret_cast<const uint16_t*>(luma + srcPlane * 2),
+                reinterpret_cast<float*>(lumaOut + dstPlane * 2),
+                xres
+            );
+        }
+    }
+}
+
+/**
+ * V210 <-> P216 through the SDK's own utilities, which take both sides as
+ * frame headers and write to whatever memory and stride the target names
+ */
+void ConvertV210(
+    NDIlib_FourCC_video_type_e from,
+    const uint8_t* src,
+    int srcStride,
+    uint8_t* dst,
+    int dstStride,
+    int xres,
+    int yres
+) {
+    NDIlib_video_frame_v2_t source = {};
+    source.xres = xres;
+    source.yres = yres;
+    source.FourCC = from;
+    source.line_stride_in_bytes = srcStride;
+    source.p_data = const_cast<uint8_t*>(src);
+    
+    NDIlib_video_frame_v2_t target = source;
+    target.line_stride_in_bytes = dstStride;
+    target.p_data = dst;
+    
+    if (IsV210(from)) {
+        target.FourCC = NDIlib_FourCC_video_type_P216;
+        NDIlib_util_V210_to_P216(&source, &target);
+    } else {
+        target.FourCC = NdiUtils::FourCCVideoV210;
+        NDIlib_util_P216_to_V210(&source, &target);
+    }
+}
+
+RowKernel FindKernel(NDIlib_FourCC_video_type_e from, NDIlib_FourCC_video_type_e to, const Kernels& kernels) {
+    // X formats are written with an opaque alpha byte, so they share the A kernels
+    if (from == NDIlib_FourCC_video_type_UYVY && IsRgb(to)) {
+        return IsRedFirst(to) ? kernels.uyvyToRgba : kernels.uyvyToBgra;
+    }
+    
+    if (IsRgb(from) && to == NDIlib_FourCC_video_type_UYVY) {
+        return IsRedFirst(from) ? kernels.rgbaToUyvy : kernels.bgraToUyvy;
+    }
+    
+    return nullptr;
+}
+
+/**
+ * Read the line stride of a frame object, which is lineStrideInBytes on
+ * frames built for sending and lineStride on captured ones
+ */
+int FrameLineStride(const Napi::Object& frame, NDIlib_FourCC_video_type_e fourCC, int xres) {
+    if (frame.Has("lineStrideInBytes") && frame.Get("lineStrideInBytes").IsNumber()) {
+        return frame.Get("lineStrideInBytes").As<Napi::Number>().Int32Value();
+    }
+    if (frame.Has("lineStride") && frame.Get("lineStride").IsNumber()) {
+        return frame.Get("lineStride").As<Napi::Number>().Int32Value();
+    }
+    return NdiUtils::DefaultLineStride(fourCC, xres);
+}
+
+/**
+ * A conversion parsed from convertVideo() arguments with its output already
+ * allocated, so it can run on any thread
+ */
+struct ConvertJob {
+    NDIlib_FourCC_video_type_e from;
+    NDIlib_FourCC_video_type_e to;
+    const uint8_t* src;
+    int srcStride;
+    uint8_t* dst;
+    int dstStride;
+    int xres;
+    int yres;
+    ConvertOptions options;
+};
+
+/**
+ * Validate (frame, fourCC, options?) and allocate the output. source and
+ * output receive the Buffers the job reads and writes. Returns false with a
+ * JavaScript exception pending if the arguments are unusable.
+ */
+bool PrepareConvert(const Napi::CallbackInfo& info, ConvertJob& job, Napi::Value& source, Napi::Value& output) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsObject() || !info[1].IsString()) {
+        Napi::TypeError::New(env, "Expected video frame object and target FourCC").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    Napi::Object frame = info[0].As<Napi::Object>();
+    
+    if (!frame.Has("data") || !frame.Get("data").IsBuffer() ||
+        !frame.Get("xres").IsNumber() || !frame.Get("yres").IsNumber() ||
+        !frame.Get("fourCC").IsString()) {
+        Napi::TypeError::New(env, "Video frame needs xres, yres, fourCC and a data Buffer").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    Napi::Buffer<uint8_t> data = frame.Get("data").As<Napi::Buffer<uint8_t>>();
+    int xres = frame.Get("xres").As<Napi::Number>().Int32Value();
+    int yres = frame.Get("yres").As<Napi::Number>().Int32Value();
+    NDIlib_FourCC_video_type_e from = NdiUtils::StringToFourCC(frame.Get("fourCC").As<Napi::String>().Utf8Value());
+    NDIlib_FourCC_video_type_e to = NdiUtils::StringToFourCC(info[1].As<Napi::String>().Utf8Value());
+    int srcStride = FrameLineStride(frame, from, xres);
+    
+    if (!CanConvert(from, to)) {
+        Napi::Error::New(env, "No conversion from " + NdiUtils::FourCCToString(from) +
+                         " to " + NdiUtils::FourCCToString(to)).ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    if (xres <= 0 || yres <= 0 || (xres & 1) != 0) {
+        Napi::Error::New(env, "Video frame width must be positive and even").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    if (!FitsLayout(from, yres, srcStride) || !FitsLayout(to, yres, 0)) {
+        Napi::Error::New(env, "Video frame height or line stride does not suit the planes of " +
+                         NdiUtils::FourCCToString(from) + " or " + NdiUtils::FourCCToString(to)).ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    if (srcStride < NdiUtils::DefaultLineStride(from, xres) ||
+        FrameDataSize(from, xres, yres, srcStride) > data.Length()) {
+        Napi::Error::New(env, "Video frame data is smaller than its xres, yres and line stride").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    int dstStride = NdiUtils::DefaultLineStride(to, xres);
+    ConvertOptions convertOptions;
+    Napi::Value into;
+    
+    if (info.Length() > 2 && info[2].IsObject()) {
+        Napi::Object options = info[2].As<Napi::Object>();
+        
+        if (options.Has("lineStrideInBytes") && options.Get("lineStrideInBytes").IsNumber()) {
+            dstStride = options.Get("lineStrideInBytes").As<Napi::Number>().Int32Value();
+            
+            if (dstStride < NdiUtils::DefaultLineStride(to, xres)) {
+                Napi::Error::New(env, "lineStrideInBytes is too small for the frame width").ThrowAsJavaScriptException();
+                return false;
+            }
+            
+            if (!FitsLayout(to, yres, dstStride)) {
+                Napi::Error::New(env, "lineStrideInBytes does not suit the planes of " +
+                                 NdiUtils::FourCCToString(to)).ThrowAsJavaScriptException();
+                return false;
+            }
+        }
+        
+        if (options.Has("reference") && options.Get("reference").IsBoolean()) {
+            convertOptions.reference = options.Get("reference").As<Napi::Boolean>().Value();
+        }
+        
+        if (options.Has("dither") && options.Get("dither").IsBoolean()) {
+            convertOptions.dither = options.Get("dither").As<Napi::Boolean>().Value();
+        }
+        
+        if (options.Has("into") && options.Get("into").IsBuffer()) {
+            into = options.Get("into");
+        }
+    }
+    
+    size_t dstSize = FrameDataSize(to, xres, yres, dstStride);
+    
+    if (!into.IsEmpty()) {
+        Napi::Buffer<uint8_t> target = into.As<Napi::Buffer<uint8_t>>();
+        if (target.Length() < dstSize) {
+            Napi::Error::New(env, "Target Buffer is too small for the converted frame").ThrowAsJavaScriptException();
+            return false;
+        }
+        job.dst = target.Data();
+        output = target;
+    } else {
+        // Pooled like received frames, and aligned for the SIMD stores
+        NdiUtils::FramePayload payload;
+        NdiFramePool::AcquirePayload(
+            NdiFramePool::FrameKey{ xres, yres, dstStride, static_cast<uint32_t>(to) },
+            dstSize,
+            payload
+        );
+        job.dst = payload.data;
+        output = payload.ToBuffer(env);
+    }
+    
+    job.from = from;
+    job.to = to;
+    job.src = data.Data();
+    job.srcStride = srcStride;
+    job.dstStride = dstStride;
+    job.xres = xres;
+    job.yres = yres;
+    job.options = convertOptions;
+    source = data;
+    return true;
+}
+
+void RunConvertJob(const ConvertJob& job) {
+    Convert(job.from, job.src, job.srcStride, job.to, job.dst, job.dstStride, job.xres, job.yres, job.options);
+}
+
+Napi::Object ConvertedFrameToObject(Napi::Env env, const ConvertJob& job, Napi::Value data) {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("xres", Napi::Number::New(env, job.xres));
+    result.Set("yres", Napi::Number::New(env, job.yres));
+    result.Set("fourCC", Napi::String::New(env, NdiUtils::FourCCToString(job.to)));
+    result.Set("lineStrideInBytes", Napi::Number::New(env, job.dstStride));
+    result.Set("data", data);
+    return result;
+}
+
+Napi::Value ConvertVideo(const Napi::CallbackInfo& info) {
+    ConvertJob job;
+    Napi::Value source;
+    Napi::Value output;
+    
+    if (!PrepareConvert(info, job, source, output)) {
+        return info.Env().Null();
+    }
+    
+    RunConvertJob(job);
+    return ConvertedFrameToObject(info.Env(), job, output);
+}
+
+/**
+ * Runs a conversion on the NdiExecutor, keeping the source and output
+ * Buffers alive until it resolves
+ */
+class ConvertVideoWorker : public NdiAsyncWorker {
+public:
+    ConvertVideoWorker(Napi::Env env, const ConvertJob& job, Napi::Value source, Napi::Value output)
+        : NdiAsyncWorker(env),
+          m_deferred(Napi::Promise::Deferred::New(env)),
+          m_job(job),
+          m_source(Napi::Persistent(source.As<Napi::Object>())),
+          m_output(Napi::Persistent(output.As<Napi::Object>())) {}
+    
+    void Execute() override {
+        RunConvertJob(m_job);
+    }
+    
+    void OnOK() override {
+        Napi::Object result = ConvertedFrameToObject(Env(), m_job, m_output.Value());
+        m_source.Reset();
+        m_output.Reset();
+        m_deferred.Resolve(result);
+    }
+    
+    void OnAbandon() override {
+        m_source.SuppressDestruct();
+        m_output.SuppressDestruct();
+    }
+    
+    Napi::Promise::Deferred m_deferred;
+
+private:
+    ConvertJob m_job;
+    Napi::ObjectReference m_source;
+    Napi::ObjectReference m_output;
+};
+
+Napi::Value ConvertVideoAsync(const Napi::CallbackInfo& info) {
+    ConvertJob job;
+    Napi::Value source;
+    Napi::Value output;
+    
+    if (!PrepareConvert(info, job, source, output)) {
+        return info.Env().Null();
+    }
+    
+    ConvertVideoWorker* worker = new ConvertVideoWorker(info.Env(), job, source, output);
+    Napi::Promise promise = worker->m_deferred.Promise();
+    worker->Queue();
+    
+    return promise;
+}
+
+Napi::Value GetConvertImplementation(const Napi::CallbackInfo& info) {
+    return Napi::String::New(info.Env(), Implementation());
+}
+
+} // namespace
+
+bool CanConvert(NDIlib_FourCC_video_type_e from, NDIlib_FourCC_video_type_e to) {
+    if (IsV210(from) || IsV210(to)) {
+        // The SDK only pairs V210 with P216
+        return (IsV210(from) && to == NDIlib_FourCC_video_type_P216) ||
+               (from == NDIlib_FourCC_video_type_P216 && IsV210(to));
+    }
+    
+    if (IsFloat(to)) {
+        // Alpha only unpacks from PA16
+        return Is16Bit(from) && (to == NdiUtils::FourCCVideoF216 || from == NDIlib_FourCC_video_type_PA16);
+    }
+    
+    if (IsPlanar(from) || IsPlanar(to) || Is16Bit(from)) {
+        // These pass through UYVY, which reaches every other 8-bit format
+        bool fromOk = from == NDIlib_FourCC_video_type_UYVY || IsRgb(from) || IsPlanar(from) || Is16Bit(from);
+        bool toOk = to == NDIlib_FourCC_video_type_UYVY || IsRgb(to) || IsPlanar(to);
+        return fromOk && toOk && from != to;
+    }
+    
+    return FindKernel(from, to, kScalarKernels) != nullptr;
+}
+
+bool Convert(
+    NDIlib_FourCC_video_type_e from,
+    const uint8_t* src,
+    int srcStride,
+    NDIlib_FourCC_video_type_e to,
+    uint8_t* dst,
+    int dstStride,
+    int xres,
+    int yres,
+    const ConvertOptions& options
+) {
+    const Kernels& kernels = options.reference ? kScalarKernels : ActiveKernels();
+    
+    if (!CanConvert(from, to) || !FitsLayout(from, yres, srcStride) || !FitsLayout(to, yres, dstStride)) {
+        return false;
+    }
+    
+    if (IsV210(from) || IsV210(to)) {
+        ConvertV210(from, src, srcStride, dst, dstStride, xres, yres);
+        return true;
+    }
+    
+    if (IsFloat(to)) {
+        UnpackFloat(kernels, to, src, srcStride, dst, dstStride, xres, yres);
+        return true;
+    }
+    
+    if (!IsPlanar(from) && !IsPlanar(to) && !Is16Bit(from)) {
+        RowKernel kernel = FindKernel(from, to, kernels);
+        if (!kernel) {
+            return false;
+        }
+        
+        for (int line = 0; line < yres; line++) {
+            kernel(src + static_cast<size_t>(line) * srcStride, dst + static_cast<size_t>(line) * dstStride, xres);
+        }
+        
+        return true;
+    }
+    
+    // Planar and 16-bit frames go through UYVY a line pair at a time, small
+    // enough to stay in L1. A UYVY target is written directly.
+    std::vector<uint8_t> scratch(static_cast<size_t>(xres) * 4);
+    bool toUyvy = to == NDIlib_FourCC_video_type_UYVY;
+    
+    // PA16 alpha is narrowed separately into formats that keep it
+    bool alpha = from == NDIlib_FourCC_video_type_PA16 &&
+                 (to == NDIlib_FourCC_video_type_BGRA || to == NDIlib_FourCC_video_type_RGBA);
+    
+    for (int line = 0; line < yres; line += 2) {
+        const uint8_t* uyvy[2] = { nullptr, nullptr };
+        int lines = yres - line < 2 ? 1 : 2;
+        
+        for (int i = 0; i < lines; i++) {
+            uint8_t* out = toUyvy
+                ? dst + static_cast<size_t>(line + i) * dstStride
+                : scratch.data() + static_cast<size_t>(i) * xres * 2;
+            uyvy[i] = LineToUyvy(kernels, from, src, srcStride, yres, line + i, options.dither, out, xres);
+        }
+        
+        UyvyToLines(kernels, to, uyvy, lines, dst, dstStride, yres, line, xres);
+        
+        for (int i = 0; alpha && i < lines; i++) {
+            size_t alphaLine = static_cast<size_t>(srcStride) * yres * 2 + static_cast<size_t>(line + i) * srcStride;
+            kernels.alphaToRgb(
+                reinterpret_cast<const uint16_t*>(src + alphaLine),
+                DitherRow(options.dither, line + i),
+                dst + static_cast<size_t>(line + i) * dstStride,
+                xres
+            );
+        }
+    }
+    
+    return true;
+}
+
+bool ConvertVideoFrame(
+    const NDIlib_video_frame_v2_t& frame,
+    NDIlib_FourCC_video_type_e to,
+    NDIlib_video_frame_v2_t& converted,
+    NdiUtils::FramePayload& payload,
+    const ConvertOptions& options
+) {
+    if (!frame.p_data || frame.xres <= 0 || frame.yres <= 0 || (frame.xres & 1) != 0 ||
+        frame.line_stride_in_bytes <= 0 || !CanConvert(frame.FourCC, to) ||
+        !FitsLayout(frame.FourCC, frame.yres, frame.line_stride_in_bytes) || !FitsLayout(to, frame.yres, 0)) {
+        return false;
+    }
+    
+    int stride = NdiUtils::DefaultLineStride(to, frame.xres);
+    size_t size = FrameDataSize(to, frame.xres, frame.yres, stride);
+    
+    NdiFramePool::AcquirePayload(
+        NdiFramePool::FrameKey{ frame.xres, frame.yres, stride, static_cast<uint32_t>(to) },
+        size,
+        payload
+    );
+    Convert(frame.FourCC, frame.p_data, frame.line_stride_in_bytes, to, payload.data, stride, frame.xres, frame.yres, options);
+    
+    converted = frame;
+    converted.FourCC = to;
+    converted.line_stride_in_bytes = stride;
+    converted.p_data = payload.data;
+    return true;
+}
+
+const char* Implementation() {
+    return ActiveKernels().name;
+}
+
+void Init(Napi::Env env, Napi::Object exports) {
+    ActiveKernels();
+    
+    exports.Set("convertVideo", Napi::Function::New(env, ConvertVideo));
+    exports.Set("convertVideoAsync", Napi::Function::New(env, ConvertVideoAsync));
+    exports.Set("getConvertImplementation", Napi::Function::New(env, GetConvertImplementation));
+}
+
+} // namespace NdiConvert
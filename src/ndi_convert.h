@@ -0,0 +1,84 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Convert - Pixel format conversion between NDI video FourCCs
+ */
+
+#ifndef NDI_CONVERT_H
+#define NDI_CONVERT_H
+
+#include <napi.h>
+#include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include "ndi_utils.h"
+#include <cstdint>
+
+namespace NdiConvert {
+
+struct ConvertOptions {
+    // Ordered dither instead of rounding when narrowing 16-bit samples
+    bool dither = false;
+    
+    // Run the portable scalar kernels instead of the SIMD ones picked for
+    // this CPU; both produce identical output
+    bool reference = false;
+};
+
+// True if frames convert from -> to: UYVY, BGRA/BGRX/RGBA/RGBX and the
+// 4:2:0 formats I420/YV12/NV12 to one another, other than RGB to RGB, and
+// P216/PA16 to any of those or to planar float F216/FA16, and P216 to and
+// from V210
+bool CanConvert(NDIlib_FourCC_video_type_e from, NDIlib_FourCC_video_type_e to);
+
+// Convert xres x yres pixels between two caller-sized images. For multi-plane
+// formats the stride is the first plane's and the others follow it as NDI
+// lays them out; 4:2:0 frames need an even height and stride, 16-bit ones an
+// even stride, float ones a multiple of 8 and V210 a multiple of 16. Returns
+// false if there is no kernel or the layout does not fit.
+bool Convert(
+    NDIlib_FourCC_video_type_e from,
+    const uint8_t* src,
+    int srcStride,
+    NDIlib_FourCC_video_type_e to,
+    uint8_t* dst,
+    int dstStride,
+    int xres,
+    int yres,
+    const ConvertOptions& options = ConvertOptions()
+);
+
+// Convert a received frame into a pooled block owned by payload. converted
+// is a copy of frame's header describing the new data. Returns false, leaving
+// both untouched, if the frame is not in a format that converts to `to`.
+bool ConvertVideoFrame(
+    const NDIlib_video_frame_v2_t& frame,
+    NDIlib_FourCC_video_type_e to,
+    NDIlib_video_frame_v2_t& converted,
+    NdiUtils::FramePayload& payload,
+    const ConvertOptions& options = ConvertOptions()
+);
+
+// Name of the kernel set chosen for this CPU: avx2, sse2, neon or scalar
+const char* Implementation();
+
+// Register convertVideo / convertVideoAsync / getConvertImplementation on the module exports
+void Init(Napi::Env env, Napi::Object exports);
+
+} // namespace NdiConvert
+
+#endif // NDI_CONVERT_H
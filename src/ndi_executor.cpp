@@ -0,0 +1,352 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Executor - Implementation
+ */
+
+#include "ndi_executor.h"
+#include <algorithm>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+// Independent of UV_THREADPOOL_SIZE, which also defaults to 4
+static const size_t kDefaultThreads = 4;
+
+// ============================================================================
+// NdiExecutor
+// ============================================================================
+
+NdiExecutor& NdiExecutor::Instance() {
+    // Never destroyed: pool threads may still be blocked in NDI at exit
+    static NdiExecutor* instance = new NdiExecutor();
+    return *instance;
+}
+
+NdiExecutor::NdiExecutor()
+    : m_targetThreads(kDefaultThreads),
+      m_threads(0),
+      m_activeThreads(0),
+      m_maxQueueDepth(0),
+      m_completed(0),
+      m_totalWaitMs(0),
+      m_maxWaitMs(0) {
+}
+
+void NdiExecutor::Submit(Task task) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(QueuedTask{ std::move(task), std::chrono::steady_clock::now() });
+        m_maxQueueDepth = std::max(m_maxQueueDepth, m_queue.size());
+        SpawnThreadsLocked();
+    }
+    m_cv.notify_one();
+}
+
+void NdiExecutor::SetThreadCount(size_t threads) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_targetThreads = std::max<size_t>(threads, 1);
+        SpawnThreadsLocked();
+    }
+    m_cv.notify_all();
+}
+
+NdiExecutor::Stats NdiExecutor::GetStats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    Stats stats;
+    stats.threads = m_threads;
+    stats.activeThreads = m_activeThreads;
+    stats.queueDepth = m_queue.size();
+    stats.maxQueueDepth = m_maxQueueDepth;
+    stats.completed = m_completed;
+    stats.totalWaitMs = m_totalWaitMs;
+    stats.maxWaitMs = m_maxWaitMs;
+    return stats;
+}
+
+void NdiExecutor::SpawnThreadsLocked() {
+    // Threads are started lazily so an addon that never queues work costs nothing
+    while (m_threads < m_targetThreads) {
+        std::thread(&NdiExecutor::WorkerLoop, this).detach();
+        m_threads++;
+    }
+}
+
+void NdiExecutor::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    
+    while (true) {
+        m_cv.wait(lock, [this]() {
+            return !m_queue.empty() || m_threads > m_targetThreads;
+        });
+        
+        if (m_threads > m_targetThreads) {
+            m_threads--;
+            return;
+        }
+        
+        QueuedTask queued = std::move(m_queue.front());
+        m_queue.pop_front();
+        
+        double waitMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - queued.queuedAt
+        ).count();
+        m_totalWaitMs += waitMs;
+        m_maxWaitMs = std::max(m_maxWaitMs, waitMs);
+        m_activeThreads++;
+        
+        lock.unlock();
+        queued.task();
+        lock.lock();
+        
+        m_activeThreads--;
+        m_completed++;
+    }
+}
+
+static Napi::Value ConfigureThreadPool(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected options object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object options = info[0].As<Napi::Object>();
+    
+    if (options.Has("threads") && options.Get("threads").IsNumber()) {
+        int32_t threads = options.Get("threads").As<Napi::Number>().Int32Value();
+        
+        if (threads < 1) {
+            Napi::Error::New(env, "Thread pool needs at least one thread").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        NdiExecutor::Instance().SetThreadCount(static_cast<size_t>(threads));
+    }
+    
+    return env.Undefined();
+}
+
+static Napi::Value GetThreadPoolStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    NdiExecutor::Stats stats = NdiExecutor::Instance().GetStats();
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("threads", Napi::Number::New(env, static_cast<double>(stats.threads)));
+    result.Set("activeThreads", Napi::Number::New(env, static_cast<double>(stats.activeThreads)));
+    result.Set("queueDepth", Napi::Number::New(env, static_cast<double>(stats.queueDepth)));
+    result.Set("maxQueueDepth", Napi::Number::New(env, static_cast<double>(stats.maxQueueDepth)));
+    result.Set("completed", Napi::Number::New(env, static_cast<double>(stats.completed)));
+    result.Set("averageWaitMs", Napi::Number::New(env, stats.completed > 0 ? stats.totalWaitMs / stats.completed : 0));
+    result.Set("maxWaitMs", Napi::Number::New(env, stats.maxWaitMs));
+    
+    return result;
+}
+
+void NdiExecutor::Init(Napi::Env env, Napi::Object exports) {
+    exports.Set("configureThreadPool", Napi::Function::New(env, ConfigureThreadPool));
+    exports.Set("getThreadPoolStats", Napi::Function::New(env, GetThreadPoolStats));
+}
+
+// ============================================================================
+// NdiAsyncWorker
+// ============================================================================
+
+/**
+ * One ThreadSafeFunction per environment carries finished workers back to the
+ * JavaScript thread. It only holds the event loop open while work is pending.
+ * When the environment goes away the queue is marked closing and outlives it
+ * until the last worker still on the pool has dropped its reference.
+ */
+struct NdiCompletionQueue {
+    Napi::ThreadSafeFunction tsfn;
+    size_t outstanding;
+    bool closing;
+    
+    // Handed to the TSFN but not yet completed. Node drains these without an
+    // environment at teardown, so Complete() never runs and they are freed here.
+    std::unordered_set<NdiAsyncWorker*> queued;
+    
+    void AbandonQueued();
+};
+
+// Guards the map and every queue's outstanding / closing fields
+static std::mutex g_completionMutex;
+static std::unordered_map<napi_env, NdiCompletionQueue*> g_completionQueues;
+
+static void RemoveCompletionQueue(void* arg) {
+    napi_env env = static_cast<napi_env>(arg);
+    std::lock_guard<std::mutex> lock(g_completionMutex);
+    
+    auto it = g_completionQueues.find(env);
+    if (it == g_completionQueues.end()) {
+        return;
+    }
+    
+    // Workers still running see closing and never touch the TSFN again
+    NdiCompletionQueue* queue = it->second;
+    g_completionQueues.erase(it);
+    queue->closing = true;
+    queue->tsfn.Release();
+    queue->AbandonQueued();
+    
+    if (queue->outstanding == 0) {
+        delete queue;
+    }
+}
+
+static NdiCompletionQueue* GetCompletionQueue(Napi::Env env) {
+    std::lock_guard<std::mutex> lock(g_completionMutex);
+    
+    auto it = g_completionQueues.find(env);
+    if (it != g_completionQueues.end()) {
+        return it->second;
+    }
+    
+    NdiCompletionQueue* queue = new NdiCompletionQueue();
+    queue->tsfn = Napi::ThreadSafeFunction::New(env, Napi::Function(), "NdiAsyncWorker", 0, 1);
+    queue->tsfn.Unref(env);
+    queue->outstanding = 0;
+    queue->closing = false;
+    
+    g_completionQueues[env] = queue;
+    napi_add_env_cleanup_hook(env, RemoveCompletionQueue, static_cast<napi_env>(env));
+    return queue;
+}
+
+// Called with g_completionMutex held
+void NdiCompletionQueue::AbandonQueued() {
+    for (NdiAsyncWorker* worker : queued) {
+        worker->OnAbandon();
+        delete worker;
+        outstanding--;
+    }
+    queued.clear();
+}
+
+// Drop a worker's reference from a pool thread after its environment went away
+static void AbandonCompletion(NdiCompletionQueue* queue) {
+    std::lock_guard<std::mutex> lock(g_completionMutex);
+    
+    if (--queue->outstanding == 0 && queue->closing) {
+        delete queue;
+    }
+}
+
+NdiAsyncWorker::NdiAsyncWorker(Napi::Env env)
+    : m_env(env), m_completion(nullptr), m_failed(false) {
+}
+
+NdiAsyncWorker::~NdiAsyncWorker() {
+}
+
+Napi::Env NdiAsyncWorker::Env() const {
+    return Napi::Env(m_env);
+}
+
+void NdiAsyncWorker::Queue() {
+    Napi::Env env = Env();
+    m_completion = GetCompletionQueue(env);
+    
+    {
+        std::lock_guard<std::mutex> lock(g_completionMutex);
+        if (m_completion->outstanding++ == 0) {
+            m_completion->tsfn.Ref(env);
+        }
+    }
+    
+    NdiExecutor::Instance().Submit([this]() { Run(); });
+}
+
+void NdiAsyncWorker::OnOK() {
+}
+
+void NdiAsyncWorker::OnError(const Napi::Error& error) {
+}
+
+void NdiAsyncWorker::OnAbandon() {
+}
+
+void NdiAsyncWorker::SetError(const std::string& error) {
+    m_error = error;
+    m_failed = true;
+}
+
+void NdiAsyncWorker::Run() {
+    Execute();
+    
+    napi_status status = napi_closing;
+    
+    {
+        // Held across the call so the cleanup hook cannot release the TSFN
+        // under us; the queue is unbounded, so this never waits for space
+        std::lock_guard<std::mutex> lock(g_completionMutex);
+        if (!m_completion->closing) {
+            m_completion->queued.insert(this);
+            status = m_completion->tsfn.BlockingCall(this, [](Napi::Env env, Napi::Function, NdiAsyncWorker* worker) {
+                // Drained at teardown, the cleanup hook has already freed the worker
+                if (env != nullptr) {
+                    worker->Complete();
+                }
+            });
+            if (status != napi_ok) {
+                m_completion->queued.erase(this);
+            }
+        }
+    }
+    
+    // The environment is shutting down and nobody will settle the promise
+    if (status != napi_ok) {
+        NdiCompletionQueue* completion = m_completion;
+        OnAbandon();
+        delete this;
+        AbandonCompletion(completion);
+    }
+}
+
+void NdiAsyncWorker::Complete() {
+    Napi::Env env = Env();
+    
+    {
+        Napi::HandleScope scope(env);
+        
+        if (m_failed) {
+            OnError(Napi::Error::New(env, m_error));
+        } else {
+            OnOK();
+        }
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(g_completionMutex);
+        m_completion->queued.erase(this);
+        if (--m_completion->outstanding == 0) {
+            if (m_completion->closing) {
+                delete m_completion;
+            } else {
+                m_completion->tsfn.Unref(env);
+            }
+        }
+    }
+    
+    delete this;
+}
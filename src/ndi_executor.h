@@ -0,0 +1,136 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Executor - Dedicated thread pool for blocking NDI calls
+ */
+
+#ifndef NDI_EXECUTOR_H
+#define NDI_EXECUTOR_H
+
+#include <napi.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+
+/**
+ * Fixed-size pool of threads owned by the addon. Blocking NDI calls run here
+ * instead of on the libuv threadpool, so a handful of receivers waiting out
+ * their capture timeouts can no longer starve fs, crypto or dns work.
+ */
+class NdiExecutor {
+public:
+    typedef std::function<void()> Task;
+    
+    struct Stats {
+        size_t threads;
+        size_t activeThreads;
+        size_t queueDepth;
+        size_t maxQueueDepth;
+        uint64_t completed;
+        double totalWaitMs;
+        double maxWaitMs;
+    };
+    
+    // Process-wide instance, created on first use
+    static NdiExecutor& Instance();
+    
+    // Run a task on one of the pool threads
+    void Submit(Task task);
+    
+    // Grow or shrink the pool; surplus threads exit once they are idle
+    void SetThreadCount(size_t threads);
+    
+    Stats GetStats();
+    
+    // Register configureThreadPool / getThreadPoolStats on the module exports
+    static void Init(Napi::Env env, Napi::Object exports);
+
+private:
+    struct QueuedTask {
+        Task task;
+        std::chrono::steady_clock::time_point queuedAt;
+    };
+    
+    NdiExecutor();
+    void SpawnThreadsLocked();
+    void WorkerLoop();
+    
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<QueuedTask> m_queue;
+    size_t m_targetThreads;
+    size_t m_threads;
+    size_t m_activeThreads;
+    size_t m_maxQueueDepth;
+    uint64_t m_completed;
+    double m_totalWaitMs;
+    double m_maxWaitMs;
+};
+
+// Per-environment channel that brings finished workers back to JavaScript
+struct NdiCompletionQueue;
+
+/**
+ * Drop-in replacement for Napi::AsyncWorker that runs Execute() on the
+ * NdiExecutor. OnOK() / OnError() run on the JavaScript thread afterwards
+ * and the worker then deletes itself.
+ */
+class NdiAsyncWorker {
+public:
+    virtual ~NdiAsyncWorker();
+    
+    void Queue();
+    Napi::Env Env() const;
+
+protected:
+    explicit NdiAsyncWorker(Napi::Env env);
+    
+    virtual void Execute() = 0;
+    virtual void OnOK();
+    virtual void OnError(const Napi::Error& error);
+    
+    // Runs instead of OnOK() / OnError() when the environment was torn down
+    // first, on the pool thread or from the environment's cleanup hook. It
+    // must not call into JavaScript;
+    // workers holding references suppress their destruction here.
+    virtual void OnAbandon();
+    
+    // Called from Execute() to complete with OnError() instead of OnOK()
+    void SetError(const std::string& error);
+
+private:
+    friend struct NdiCompletionQueue;
+    
+    NdiAsyncWorker(const NdiAsyncWorker&) = delete;
+    NdiAsyncWorker& operator=(const NdiAsyncWorker&) = delete;
+    
+    void Run();
+    void Complete();
+    
+    napi_env m_env;
+    NdiCompletionQueue* m_completion;
+    std::string m_error;
+    bool m_failed;
+};
+
+#endif // NDI_EXECUTOR_H
@@ -0,0 +1,89 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Frame Mailbox - Implementation
+ */
+
+#include "ndi_frame_mailbox.h"
+
+NdiFrameMailbox::NdiFrameMailbox(RecvHandle receiver, uint32_t timeout, const VideoCaptureOptions& videoOptions)
+    : m_receiver(receiver),
+      m_timeout(timeout),
+      m_videoOptions(videoOptions),
+      m_back(0),
+      m_middle(1),
+      m_front(2),
+      m_stopping(false) {
+    m_thread = std::thread(&NdiFrameMailbox::Run, this);
+}
+
+NdiFrameMailbox::~NdiFrameMailbox() {
+    Stop();
+}
+
+void NdiFrameMailbox::Stop() {
+    if (m_stopping.exchange(true)) {
+        return;
+    }
+    
+    // The thread only blocks inside NDI for at most the capture timeout
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    
+    for (auto& slot : m_slots) {
+        slot.reset();
+    }
+    m_middle.store(m_middle.load() & kIndexMask);
+}
+
+bool NdiFrameMailbox::IsRunning() const {
+    return !m_stopping.load();
+}
+
+std::unique_ptr<CapturedVideoFrame> NdiFrameMailbox::TakeLatest() {
+    if (!(m_middle.load(std::memory_order_acquire) & kFresh)) {
+        return nullptr;
+    }
+    
+    // Hand our old front slot to the writer and take the fresh middle one
+    uint8_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+    m_front = previous & kIndexMask;
+    
+    return std::move(m_slots[m_front]);
+}
+
+void NdiFrameMailbox::Run() {
+    while (!m_stopping.load()) {
+        // Replacing the slot releases a frame that was never taken back to
+        // the pool (or to NDI in zero-copy mode)
+        m_slots[m_back].reset(new CapturedVideoFrame());
+        m_slots[m_back]->valid = false;
+        
+        CaptureVideoFrame(m_receiver, m_timeout, m_videoOptions, *m_slots[m_back]);
+        
+        if (!m_slots[m_back]->valid) {
+            continue;
+        }
+        
+        // Publish; an untaken frame in the middle becomes the next back slot
+        uint8_t previous = m_middle.exchange(m_back | kFresh, std::memory_order_acq_rel);
+        m_back = previous & kIndexMask;
+    }
+}
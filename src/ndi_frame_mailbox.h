@@ -0,0 +1,74 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Frame Mailbox - Latest-frame video capture for preview consumers
+ */
+
+#ifndef NDI_FRAME_MAILBOX_H
+#define NDI_FRAME_MAILBOX_H
+
+#include <napi.h>
+#include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include "ndi_async.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+/**
+ * Captures video on its own thread and keeps only the newest frame. Frames
+ * live in a triple buffer: the capture thread fills the back slot and swaps
+ * it with the middle one, the JavaScript thread swaps the middle slot into
+ * the front when it is fresh. Neither side ever waits for the other, and
+ * frames nobody asked for are recycled without becoming JavaScript objects.
+ */
+class NdiFrameMailbox {
+public:
+    NdiFrameMailbox(RecvHandle receiver, uint32_t timeout, const VideoCaptureOptions& videoOptions);
+    ~NdiFrameMailbox();
+    
+    // Stop capturing and join the thread; frames not taken are released
+    void Stop();
+    bool IsRunning() const;
+    
+    // Take the newest frame published since the last call, or null if none.
+    // Must only be called from one thread.
+    std::unique_ptr<CapturedVideoFrame> TakeLatest();
+
+private:
+    // The shared middle index carries this bit while it holds an untaken frame
+    static const uint8_t kFresh = 0x4;
+    static const uint8_t kIndexMask = 0x3;
+    
+    void Run();
+    
+    RecvHandle m_receiver;
+    uint32_t m_timeout;
+    VideoCaptureOptions m_videoOptions;
+    
+    std::unique_ptr<CapturedVideoFrame> m_slots[3];
+    uint8_t m_back;
+    std::atomic<uint8_t> m_middle;
+    uint8_t m_front;
+    
+    std::atomic<bool> m_stopping;
+    std::thread m_thread;
+};
+
+#endif // NDI_FRAME_MAILBOX_H
@@ -0,0 +1,322 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Frame Pool - Implementation
+ */
+
+#include "ndi_frame_pool.h"
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+namespace NdiFramePool {
+
+namespace {
+
+struct FrameKeyHash {
+    size_t operator()(const FrameKey& key) const {
+        size_t hash = std::hash<int>()(key.width);
+        hash = hash * 31 + std::hash<int>()(key.height);
+        hash = hash * 31 + std::hash<int>()(key.stride);
+        hash = hash * 31 + std::hash<uint32_t>()(key.fourCC);
+        return hash;
+    }
+};
+
+// Idle blocks for one key, all blockSize bytes long
+struct Bucket {
+    size_t blockSize;
+    std::vector<uint8_t*> blocks;
+};
+
+// Enough for a handful of 4K BGRA frames
+const size_t kDefaultMaxBytes = 256 * 1024 * 1024;
+
+std::mutex g_poolMutex;
+std::unordered_map<FrameKey, Bucket, FrameKeyHash> g_buckets;
+size_t g_maxBytes = kDefaultMaxBytes;
+size_t g_pooledBytes = 0;
+size_t g_pooledBlocks = 0;
+size_t g_outstandingBytes = 0;
+uint64_t g_hits = 0;
+uint64_t g_misses = 0;
+uint64_t g_discarded = 0;
+
+// Live AllocateSendBuffer() blocks and how many sends are using each
+std::mutex g_sendMutex;
+std::unordered_map<const uint8_t*, unsigned> g_sendBuffers;
+
+uint8_t* AllocateBlock(size_t size) {
+    return static_cast<uint8_t*>(::operator new(size, std::align_val_t(kAlignment)));
+}
+
+void FreeBlock(uint8_t* block) {
+    ::operator delete(block, std::align_val_t(kAlignment));
+}
+
+// Free idle blocks of other keys until `needed` more bytes fit under the cap.
+// Keeps a stream that changed resolution from being starved by stale buckets.
+void EvictLocked(const FrameKey* keep, size_t needed) {
+    auto it = g_buckets.begin();
+    while (it != g_buckets.end() && g_pooledBytes + needed > g_maxBytes) {
+        if (keep && it->first == *keep) {
+            ++it;
+            continue;
+        }
+        
+        Bucket& bucket = it->second;
+        while (!bucket.blocks.empty() && g_pooledBytes + needed > g_maxBytes) {
+            FreeBlock(bucket.blocks.back());
+            bucket.blocks.pop_back();
+            g_pooledBytes -= bucket.blockSize;
+            g_pooledBlocks--;
+        }
+        
+        if (bucket.blocks.empty()) {
+            it = g_buckets.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+FrameKey AudioKey(const NDIlib_audio_frame_v2_t& frame) {
+    return FrameKey{
+        frame.no_samples,
+        frame.no_channels,
+        frame.channel_stride_in_bytes,
+        static_cast<uint32_t>(NDIlib_FourCC_audio_type_FLTP)
+    };
+}
+
+FrameKey VideoKey(const NDIlib_video_frame_v2_t& frame) {
+    return FrameKey{
+        frame.xres,
+        frame.yres,
+        frame.line_stride_in_bytes,
+        static_cast<uint32_t>(frame.FourCC)
+    };
+}
+
+// Block behind a typed array, or null for anything else
+const uint8_t* ViewBlock(Napi::Value data) {
+    if (!data.IsTypedArray()) {
+        return nullptr;
+    }
+    return static_cast<const uint8_t*>(data.As<Napi::TypedArray>().ArrayBuffer().Data());
+}
+
+void CopyToPayload(const FrameKey& key, const void* src, size_t size, NdiUtils::FramePayload& payload) {
+    AcquirePayload(key, size, payload);
+    memcpy(payload.data, src, size);
+}
+
+Napi::Value SetFramePoolOptions(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected options object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object options = info[0].As<Napi::Object>();
+    
+    if (options.Has("maxBytes") && options.Get("maxBytes").IsNumber()) {
+        double maxBytes = options.Get("maxBytes").As<Napi::Number>().DoubleValue();
+        SetMaxBytes(maxBytes > 0 ? static_cast<size_t>(maxBytes) : 0);
+    }
+    
+    return env.Undefined();
+}
+
+Napi::Value GetFramePoolStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Stats stats = GetStats();
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("hits", Napi::Number::New(env, static_cast<double>(stats.hits)));
+    result.Set("misses", Napi::Number::New(env, static_cast<double>(stats.misses)));
+    result.Set("discarded", Napi::Number::New(env, static_cast<double>(stats.discarded)));
+    result.Set("pooledBytes", Napi::Number::New(env, static_cast<double>(stats.pooledBytes)));
+    result.Set("pooledBlocks", Napi::Number::New(env, static_cast<double>(stats.pooledBlocks)));
+    result.Set("outstandingBytes", Napi::Number::New(env, static_cast<double>(stats.outstandingBytes)));
+    result.Set("maxBytes", Napi::Number::New(env, static_cast<double>(stats.maxBytes)));
+    
+    return result;
+}
+
+} // namespace
+
+uint8_t* Acquire(const FrameKey& key, size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(g_poolMutex);
+        g_outstandingBytes += size;
+        
+        auto it = g_buckets.find(key);
+        if (it != g_buckets.end() && !it->second.blocks.empty() && it->second.blockSize == size) {
+            uint8_t* block = it->second.blocks.back();
+            it->second.blocks.pop_back();
+            g_pooledBytes -= size;
+            g_pooledBlocks--;
+            g_hits++;
+            return block;
+        }
+        
+        g_misses++;
+    }
+    
+    // Allocate outside the lock, large blocks can take a while to map
+    return AllocateBlock(size);
+}
+
+void Release(const FrameKey& key, uint8_t* block, size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(g_poolMutex);
+        g_outstandingBytes -= size;
+        
+        if (size <= g_maxBytes) {
+            EvictLocked(&key, size);
+        }
+        
+        if (g_pooledBytes + size <= g_maxBytes) {
+            Bucket& bucket = g_buckets[key];
+            if (bucket.blocks.empty()) {
+                bucket.blockSize = size;
+            }
+            
+            if (bucket.blockSize == size) {
+                bucket.blocks.push_back(block);
+                g_pooledBytes += size;
+                g_pooledBlocks++;
+                return;
+            }
+        }
+        
+        g_discarded++;
+    }
+    
+    FreeBlock(block);
+}
+
+void AcquirePayload(const FrameKey& key, size_t size, NdiUtils::FramePayload& payload) {
+    uint8_t* block = Acquire(key, size);
+    payload.data = block;
+    payload.size = size;
+    payload.release = [key, block, size]() { Release(key, block, size); };
+}
+
+void CopyVideoFrame(const NDIlib_video_frame_v2_t& frame, NdiUtils::FramePayload& payload) {
+    if (!frame.p_data || frame.yres <= 0 || frame.line_stride_in_bytes <= 0) {
+        return;
+    }
+    
+    CopyToPayload(VideoKey(frame), frame.p_data, NdiUtils::VideoFrameDataSize(frame), payload);
+}
+
+void CopyAudioFrame(const NDIlib_audio_frame_v2_t& frame, NdiUtils::FramePayload& payload) {
+    if (!frame.p_data || frame.no_channels <= 0 || frame.no_samples <= 0 || frame.channel_stride_in_bytes <= 0) {
+        return;
+    }
+    
+    size_t dataSize = static_cast<size_t>(frame.no_channels) * static_cast<size_t>(frame.channel_stride_in_bytes);
+    CopyToPayload(AudioKey(frame), frame.p_data, dataSize, payload);
+}
+
+Napi::Buffer<uint8_t> AllocateSendBuffer(Napi::Env env, const FrameKey& key, size_t size) {
+    uint8_t* block = Acquire(key, size);
+    
+    {
+        std::lock_guard<std::mutex> lock(g_sendMutex);
+        g_sendBuffers[block] = 0;
+    }
+    
+    NdiUtils::FramePayload payload;
+    payload.data = block;
+    payload.size = size;
+    payload.release = [key, block, size]() {
+        {
+            std::lock_guard<std::mutex> lock(g_sendMutex);
+            g_sendBuffers.erase(block);
+        }
+        Release(key, block, size);
+    };
+    
+    // A runtime without external buffers hands back an unregistered copy
+    return payload.ToBuffer(env);
+}
+
+bool BeginSend(Napi::Value data) {
+    const uint8_t* block = ViewBlock(data);
+    if (!block) {
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(g_sendMutex);
+    auto it = g_sendBuffers.find(block);
+    if (it == g_sendBuffers.end()) {
+        return false;
+    }
+    
+    it->second++;
+    return true;
+}
+
+void EndSend(Napi::Env env, Napi::Value data) {
+    const uint8_t* block = ViewBlock(data);
+    
+    {
+        std::lock_guard<std::mutex> lock(g_sendMutex);
+        auto it = g_sendBuffers.find(block);
+        if (it == g_sendBuffers.end() || --it->second > 0) {
+            return;
+        }
+    }
+    
+    // Runs the release callback above, which unregisters the block
+    NdiUtils::ReleaseBuffer(env, data);
+}
+
+void SetMaxBytes(size_t maxBytes) {
+    std::lock_guard<std::mutex> lock(g_poolMutex);
+    g_maxBytes = maxBytes;
+    EvictLocked(nullptr, 0);
+}
+
+Stats GetStats() {
+    std::lock_guard<std::mutex> lock(g_poolMutex);
+    
+    Stats stats;
+    stats.hits = g_hits;
+    stats.misses = g_misses;
+    stats.discarded = g_discarded;
+    stats.pooledBytes = g_pooledBytes;
+    stats.pooledBlocks = g_pooledBlocks;
+    stats.outstandingBytes = g_outstandingBytes;
+    stats.maxBytes = g_maxBytes;
+    return stats;
+}
+
+void Init(Napi::Env env, Napi::Object exports) {
+    exports.Set("setFramePoolOptions", Napi::Function::New(env, SetFramePoolOptions));
+    exports.Set("getFramePoolStats", Napi::Function::New(env, GetFramePoolStats));
+}
+
+} // namespace NdiFramePool
@@ -0,0 +1,94 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Frame Pool - Recycled buffers for received video and audio frames
+ */
+
+#ifndef NDI_FRAME_POOL_H
+#define NDI_FRAME_POOL_H
+
+#include <napi.h>
+#include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include "ndi_utils.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace NdiFramePool {
+
+// Alignment of every pooled block, enough for any SIMD load/store
+const size_t kAlignment = 64;
+
+// Frames with the same key always need the same block size. Audio frames use
+// width = samples, height = channels and the FLTP FourCC.
+struct FrameKey {
+    int width;
+    int height;
+    int stride;
+    uint32_t fourCC;
+    
+    bool operator==(const FrameKey& other) const {
+        return width == other.width && height == other.height &&
+               stride == other.stride && fourCC == other.fourCC;
+    }
+};
+
+struct Stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t discarded;
+    size_t pooledBytes;
+    size_t pooledBlocks;
+    size_t outstandingBytes;
+    size_t maxBytes;
+};
+
+// Take a block for the key, reusing an idle one when available
+uint8_t* Acquire(const FrameKey& key, size_t size);
+
+// Return a block to the pool, or free it if the pool is full
+void Release(const FrameKey& key, uint8_t* block, size_t size);
+
+// Hand a pooled block of size bytes to payload; its contents are undefined
+void AcquirePayload(const FrameKey& key, size_t size, NdiUtils::FramePayload& payload);
+
+// Copy captured frame data into a pooled block owned by payload
+void CopyVideoFrame(const NDIlib_video_frame_v2_t& frame, NdiUtils::FramePayload& payload);
+void CopyAudioFrame(const NDIlib_audio_frame_v2_t& frame, NdiUtils::FramePayload& payload);
+
+// Wrap a pooled block in a writable Buffer for an outgoing frame
+Napi::Buffer<uint8_t> AllocateSendBuffer(Napi::Env env, const FrameKey& key, size_t size);
+
+// True if data is a view over a live AllocateSendBuffer() block; counts one more
+// send in flight until the matching EndSend()
+bool BeginSend(Napi::Value data);
+
+// The last send in flight to finish detaches the Buffer and recycles its block
+void EndSend(Napi::Env env, Napi::Value data);
+
+// Cap the bytes kept idle in the pool (0 disables recycling)
+void SetMaxBytes(size_t maxBytes);
+
+Stats GetStats();
+
+// Register setFramePoolOptions / getFramePoolStats on the module exports
+void Init(Napi::Env env, Napi::Object exports);
+
+} // namespace NdiFramePool
+
+#endif // NDI_FRAME_POOL_H
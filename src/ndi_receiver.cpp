@@ -23,6 +23,7 @@
 #include "ndi_receiver.h"
 #include "ndi_utils.h"
 #include "ndi_async.h"
+#include "ndi_convert.h"
 #include <cstring>
 
 Napi::FunctionReference NdiReceiver::constructor;
@@ -35,9 +36,25 @@ Napi::Object NdiReceiver::Init(Napi::Env env, Napi::Object exports) {
         InstanceMethod("capture", &NdiReceiver::Capture),
         InstanceMethod("captureVideo", &NdiReceiver::CaptureVideo),
         InstanceMethod("captureAudio", &NdiReceiver::CaptureAudio),
+        InstanceMethod("captureVideoInto", &NdiReceiver::CaptureVideoInto),
+        InstanceMethod("captureAudioInto", &NdiReceiver::CaptureAudioInto),
+        InstanceMethod("captureVideoPacked", &NdiReceiver::CaptureVideoPacked),
+        InstanceMethod("captureAudioPacked", &NdiReceiver::CaptureAudioPacked),
         InstanceMethod("captureAsync", &NdiReceiver::CaptureAsync),
         InstanceMethod("captureVideoAsync", &NdiReceiver::CaptureVideoAsync),
         InstanceMethod("captureAudioAsync", &NdiReceiver::CaptureAudioAsync),
+        InstanceMethod("captureVideoIntoAsync", &NdiReceiver::CaptureVideoIntoAsync),
+        InstanceMethod("captureAudioIntoAsync", &NdiReceiver::CaptureAudioIntoAsync),
+        InstanceMethod("startCaptureThread", &NdiReceiver::StartCaptureThread),
+        InstanceMethod("stopCaptureThread", &NdiReceiver::StopCaptureThread),
+        InstanceMethod("pauseCaptureThread", &NdiReceiver::PauseCaptureThread),
+        InstanceMethod("resumeCaptureThread", &NdiReceiver::ResumeCaptureThread),
+        InstanceMethod("getCaptureStats", &NdiReceiver::GetCaptureStats),
+        InstanceMethod("startFrameQueue", &NdiReceiver::StartFrameQueue),
+        InstanceMethod("nextFrame", &NdiReceiver::NextFrame),
+        InstanceMethod("startLatestVideo", &NdiReceiver::StartLatestVideo),
+        InstanceMethod("stopLatestVideo", &NdiReceiver::StopLatestVideo),
+        InstanceMethod("getLatestVideo", &NdiReceiver::GetLatestVideo),
         InstanceMethod("setTally", &NdiReceiver::SetTally),
         InstanceMethod("sendMetadata", &NdiReceiver::SendMetadata),
         InstanceMethod("ptzIsSupported", &NdiReceiver::PtzIsSupported),
@@ -120,6 +137,36 @@ NdiReceiver::NdiReceiver(const Napi::CallbackInfo& info)
             recvName = options.Get("name").As<Napi::String>().Utf8Value();
             recv_create.p_ndi_recv_name = recvName.c_str();
         }
+        
+        if (options.Has("zeroCopy") && options.Get("zeroCopy").IsBoolean()) {
+            m_videoOptions.zeroCopy = options.Get("zeroCopy").As<Napi::Boolean>().Value();
+        }
+        
+        if (options.Has("convertTo") && options.Get("convertTo").IsString()) {
+            std::string fourCC = options.Get("convertTo").As<Napi::String>().Utf8Value();
+            m_videoOptions.convertTo = NdiUtils::StringToFourCC(fourCC);
+            
+            if (NdiUtils::FourCCToString(m_videoOptions.convertTo) != fourCC) {
+                Napi::TypeError::New(env, "Unknown convertTo FourCC: " + fourCC).ThrowAsJavaScriptException();
+                return;
+            }
+        }
+        
+        if (options.Has("dither") && options.Get("dither").IsBoolean()) {
+            m_videoOptions.dither = options.Get("dither").As<Napi::Boolean>().Value();
+        }
+        
+        if (options.Has("proxy") && options.Get("proxy").IsObject()) {
+            Napi::Object proxy = options.Get("proxy").As<Napi::Object>();
+            
+            if (!NdiScale::ParseScaleOptions(env, proxy, m_videoOptions.proxy)) {
+                return;
+            }
+            
+            if (proxy.Has("only") && proxy.Get("only").IsBoolean()) {
+                m_videoOptions.proxyOnly = proxy.Get("only").As<Napi::Boolean>().Value();
+            }
+        }
     }
     
     m_receiver = NDIlib_recv_create_v3(&recv_create);
@@ -128,13 +175,15 @@ NdiReceiver::NdiReceiver(const Napi::CallbackInfo& info)
         Napi::Error::New(env, "Failed to create NDI receiver instance").ThrowAsJavaScriptException();
         return;
     }
+    
+    m_handle = RecvHandle(m_receiver, NDIlib_recv_destroy);
 }
 
 NdiReceiver::~NdiReceiver() {
-    if (m_receiver && !m_destroyed) {
-        NDIlib_recv_destroy(m_receiver);
-        m_receiver = nullptr;
-    }
+    m_captureThread.reset();
+    m_mailbox.reset();
+    m_handle.reset();
+    m_receiver = nullptr;
 }
 
 Napi::Value NdiReceiver::Connect(const Napi::CallbackInfo& info) {
@@ -170,6 +219,10 @@ Napi::Value NdiReceiver::Capture(const Napi::CallbackInfo& info) {
         return env.Null();
     }
     
+    if (!CheckCaptureIdle(env)) {
+        return env.Null();
+    }
+    
     uint32_t timeout = 1000;
     if (info.Length() > 0 && info[0].IsNumber()) {
         timeout = info[0].As<Napi::Number>().Uint32Value();
@@ -187,30 +240,30 @@ Napi::Value NdiReceiver::Capture(const Napi::CallbackInfo& info) {
         timeout
     );
     
-    Napi::Object result = Napi::Object::New(env);
-    result.Set("type", Napi::String::New(env, NdiUtils::FrameTypeToString(frameType)));
+    Napi::Value video = env.Undefined();
+    Napi::Value audio = env.Undefined();
+    Napi::Value metadata = env.Undefined();
     
     switch (frameType) {
         case NDIlib_frame_type_video:
-            result.Set("video", NdiUtils::VideoFrameToObject(env, videoFrame));
-            NDIlib_recv_free_video_v2(m_receiver, &videoFrame);
+            video = VideoFrameToObject(env, videoFrame);
             break;
-            
+        
         case NDIlib_frame_type_audio:
-            result.Set("audio", NdiUtils::AudioFrameToObject(env, audioFrame));
+            audio = NdiUtils::AudioFrameToObject(env, audioFrame);
             NDIlib_recv_free_audio_v2(m_receiver, &audioFrame);
             break;
-            
+        
         case NDIlib_frame_type_metadata:
-            result.Set("metadata", NdiUtils::MetadataFrameToObject(env, metadataFrame));
+            metadata = NdiUtils::MetadataFrameToObject(env, metadataFrame);
             NDIlib_recv_free_metadata(m_receiver, &metadataFrame);
             break;
-            
+        
         default:
             break;
     }
     
-    return result;
+    return NdiUtils::CaptureResultToObject(env, frameType, video, audio, metadata);
 }
 
 Napi::Value NdiReceiver::CaptureVideo(const Napi::CallbackInfo& info) {
@@ -221,6 +274,10 @@ Napi::Value NdiReceiver::CaptureVideo(const Napi::CallbackInfo& info) {
         return env.Null();
     }
     
+    if (!CheckCaptureIdle(env)) {
+        return env.Null();
+    }
+    
     uint32_t timeout = 1000;
     if (info.Length() > 0 && info[0].IsNumber()) {
         timeout = info[0].As<Napi::Number>().Uint32Value();
@@ -237,9 +294,7 @@ Napi::Value NdiReceiver::CaptureVideo(const Napi::CallbackInfo& info) {
     );
     
     if (frameType == NDIlib_frame_type_video) {
-        Napi::Object result = NdiUtils::VideoFrameToObject(env, videoFrame);
-        NDIlib_recv_free_video_v2(m_receiver, &videoFrame);
-        return result;
+        return VideoFrameToObject(env, videoFrame);
     }
     
     return env.Null();
@@ -253,6 +308,10 @@ Napi::Value NdiReceiver::CaptureAudio(const Napi::CallbackInfo& info) {
         return env.Null();
     }
     
+    if (!CheckCaptureIdle(env)) {
+        return env.Null();
+    }
+    
     uint32_t timeout = 1000;
     if (info.Length() > 0 && info[0].IsNumber()) {
         timeout = info[0].As<Napi::Number>().Uint32Value();
@@ -277,6 +336,293 @@ Napi::Value NdiReceiver::CaptureAudio(const Napi::CallbackInfo& info) {
     return env.Null();
 }
 
+Napi::Value NdiReceiver::CaptureVideoInto(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_receiver || m_destroyed) {
+        Napi::Error::New(env, "Receiver has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (!CheckCaptureIdle(env)) {
+        return env.Null();
+    }
+    
+    if (info.Length() < 1 || !info[0].IsTypedArray()) {
+        Napi::TypeError::New(env, "Expected target Buffer").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::TypedArray target = info[0].As<Napi::TypedArray>();
+    uint8_t* dst = static_cast<uint8_t*>(target.ArrayBuffer().Data()) + target.ByteOffset();
+    
+    uint32_t timeout = 1000;
+    if (info.Length() > 1 && info[1].IsNumber()) {
+        timeout = info[1].As<Napi::Number>().Uint32Value();
+    }
+    
+    NDIlib_video_frame_v2_t videoFrame = {};
+    
+    NDIlib_frame_type_e frameType = NDIlib_recv_capture_v2(
+        m_receiver,
+        &videoFrame,
+        nullptr,
+        nullptr,
+        timeout
+    );
+    
+    if (frameType != NDIlib_frame_type_video) {
+        return env.Null();
+    }
+    
+    size_t dataSize = NdiUtils::VideoFrameDataSize(videoFrame);
+    size_t bytesWritten = NdiUtils::CopyVideoFrameData(videoFrame, dst, target.ByteLength());
+    
+    Napi::Object result = NdiUtils::VideoFrameHeaderToObject(env, videoFrame);
+    result.Set("dataSize", Napi::Number::New(env, static_cast<double>(dataSize)));
+    result.Set("bytesWritten", Napi::Number::New(env, static_cast<double>(bytesWritten)));
+    result.Set("truncated", Napi::Boolean::New(env, bytesWritten < dataSize));
+    
+    NDIlib_recv_free_video_v2(m_receiver, &videoFrame);
+    return result;
+}
+
+Napi::Value NdiReceiver::CaptureAudioInto(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_receiver || m_destroyed) {
+        Napi::Error::New(env, "Receiver has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (!CheckCaptureIdle(env)) {
+        return env.Null();
+    }
+    
+    if (info.Length() < 1 || !info[0].IsTypedArray() ||
+        info[0].As<Napi::TypedArray>().TypedArrayType() != napi_float32_array) {
+        Napi::TypeError::New(env, "Expected target Float32Array").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Float32Array target = info[0].As<Napi::Float32Array>();
+    
+    uint32_t timeout = 1000;
+    if (info.Length() > 1 && info[1].IsNumber()) {
+        timeout = info[1].As<Napi::Number>().Uint32Value();
+    }
+    
+    NDIlib_audio_frame_v2_t audioFrame = {};
+    
+    NDIlib_frame_type_e frameType = NDIlib_recv_capture_v2(
+        m_receiver,
+        nullptr,
+        &audioFrame,
+        nullptr,
+        timeout
+    );
+    
+    if (frameType != NDIlib_frame_type_audio) {
+        return env.Null();
+    }
+    
+    size_t dataSize = static_cast<size_t>(audioFrame.no_samples) * audioFrame.no_channels * sizeof(float);
+    int samplesWritten = NdiUtils::CopyAudioFrameData(audioFrame, target.Data(), target.ElementLength());
+    
+    // Channels are packed back to back in the target
+    Napi::Object result = NdiUtils::AudioFrameHeaderToObject(env, audioFrame);
+    result.Set("channelStrideInBytes", Napi::Number::New(env, samplesWritten * static_cast<int>(sizeof(float))));
+    result.Set("dataSize", Napi::Number::New(env, static_cast<double>(dataSize)));
+    result.Set("samplesWritten", Napi::Number::New(env, samplesWritten));
+    result.Set("truncated", Napi::Boolean::New(env, samplesWritten < audioFrame.no_samples));
+    
+    NDIlib_recv_free_audio_v2(m_receiver, &audioFrame);
+    return result;
+}
+
+Napi::Value NdiReceiver::CaptureVideoPacked(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_receiver || m_destroyed) {
+        Napi::Error::New(env, "Receiver has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (!CheckCaptureIdle(env)) {
+        return env.Null();
+    }
+    
+    if (info.Length() < 1 || !NdiUtils::IsPackedHeader(info[0], NdiUtils::VideoHeaderLength)) {
+        Napi::TypeError::New(env, "Expected header BigInt64Array or Float64Array of VideoHeader.LENGTH").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (info.Length() < 2 || !info[1].IsTypedArray()) {
+        Napi::TypeError::New(env, "Expected target Buffer").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::TypedArray header = info[0].As<Napi::TypedArray>();
+    Napi::TypedArray target = info[1].As<Napi::TypedArray>();
+    uint8_t* dst = static_cast<uint8_t*>(target.ArrayBuffer().Data()) + target.ByteOffset();
+    
+    uint32_t timeout = 1000;
+    if (info.Length() > 2 && info[2].IsNumber()) {
+        timeout = info[2].As<Napi::Number>().Uint32Value();
+    }
+    
+    NDIlib_video_frame_v2_t videoFrame = {};
+    
+    NDIlib_frame_type_e frameType = NDIlib_recv_capture_v2(
+        m_receiver,
+        &videoFrame,
+        nullptr,
+        nullptr,
+        timeout
+    );
+    
+    if (frameType != NDIlib_frame_type_video) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    int64_t fields[NdiUtils::VideoHeaderLength];
+    fields[NdiUtils::VideoHeaderXres] = videoFrame.xres;
+    fields[NdiUtils::VideoHeaderYres] = videoFrame.yres;
+    fields[NdiUtils::VideoHeaderFourCC] = static_cast<uint32_t>(videoFrame.FourCC);
+    fields[NdiUtils::VideoHeaderFrameRateN] = videoFrame.frame_rate_N;
+    fields[NdiUtils::VideoHeaderFrameRateD] = videoFrame.frame_rate_D;
+    fields[NdiUtils::VideoHeaderFrameFormat] = videoFrame.frame_format_type;
+    fields[NdiUtils::VideoHeaderLineStride] = videoFrame.line_stride_in_bytes;
+    fields[NdiUtils::VideoHeaderTimecode] = videoFrame.timecode;
+    fields[NdiUtils::VideoHeaderTimestamp] = videoFrame.timestamp;
+    fields[NdiUtils::VideoHeaderDataSize] = static_cast<int64_t>(NdiUtils::VideoFrameDataSize(videoFrame));
+    fields[NdiUtils::VideoHeaderBytesWritten] = static_cast<int64_t>(
+        NdiUtils::CopyVideoFrameData(videoFrame, dst, target.ByteLength())
+    );
+    
+    NdiUtils::WritePackedHeader(header, fields, NdiUtils::VideoHeaderLength);
+    
+    NDIlib_recv_free_video_v2(m_receiver, &videoFrame);
+    return Napi::Boolean::New(env, true);
+}
+
+Napi::Value NdiReceiver::CaptureAudioPacked(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_receiver || m_destroyed) {
+        Napi::Error::New(env, "Receiver has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (!CheckCaptureIdle(env)) {
+        return env.Null();
+    }
+    
+    if (info.Length() < 1 || !NdiUtils::IsPackedHeader(info[0], NdiUtils::AudioHeaderLength)) {
+        Napi::TypeError::New(env, "Expected header BigInt64Array or Float64Array of AudioHeader.LENGTH").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (info.Length() < 2 || !info[1].IsTypedArray() ||
+        info[1].As<Napi::TypedArray>().TypedArrayType() != napi_float32_array) {
+        Napi::TypeError::New(env, "Expected target Float32Array").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::TypedArray header = info[0].As<Napi::TypedArray>();
+    Napi::Float32Array target = info[1].As<Napi::Float32Array>();
+    
+    uint32_t timeout = 1000;
+    if (info.Length() > 2 && info[2].IsNumber()) {
+        timeout = info[2].As<Napi::Number>().Uint32Value();
+    }
+    
+    NDIlib_audio_frame_v2_t audioFrame = {};
+    
+    NDIlib_frame_type_e frameType = NDIlib_recv_capture_v2(
+        m_receiver,
+        nullptr,
+        &audioFrame,
+        nullptr,
+        timeout
+    );
+    
+    if (frameType != NDIlib_frame_type_audio) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    // Channels are packed back to back, samplesWritten each
+    int64_t fields[NdiUtils::AudioHeaderLength];
+    fields[NdiUtils::AudioHeaderSampleRate] = audioFrame.sample_rate;
+    fields[NdiUtils::AudioHeaderNoChannels] = audioFrame.no_channels;
+    fields[NdiUtils::AudioHeaderNoSamples] = audioFrame.no_samples;
+    fields[NdiUtils::AudioHeaderTimecode] = audioFrame.timecode;
+    fields[NdiUtils::AudioHeaderTimestamp] = audioFrame.timestamp;
+    fields[NdiUtils::AudioHeaderDataSize] = static_cast<int64_t>(audioFrame.no_samples) * audioFrame.no_channels * sizeof(float);
+    fields[NdiUtils::AudioHeaderSamplesWritten] = NdiUtils::CopyAudioFrameData(audioFrame, target.Data(), target.ElementLength());
+    
+    NdiUtils::WritePackedHeader(header, fields, NdiUtils::AudioHeaderLength);
+    
+    NDIlib_recv_free_audio_v2(m_receiver, &audioFrame);
+    return Napi::Boolean::New(env, true);
+}
+
+Napi::Object NdiReceiver::VideoFrameToObject(Napi::Env env, const NDIlib_video_frame_v2_t& videoFrame) {
+    NDIlib_video_frame_v2_t scaled;
+    NdiUtils::FramePayload proxy;
+    bool hasProxy = m_videoOptions.proxy.Enabled() &&
+                    ScaleCapturedVideo(videoFrame, m_videoOptions, scaled, proxy);
+    
+    if (hasProxy && m_videoOptions.proxyOnly) {
+        Napi::Object result = NdiUtils::VideoFrameToObject(env, scaled, proxy);
+        NDIlib_recv_free_video_v2(m_receiver, &videoFrame);
+        return result;
+    }
+    
+    Napi::Object result = FullVideoFrameToObject(env, videoFrame);
+    
+    if (hasProxy) {
+        result.Set("proxy", NdiUtils::VideoFrameToObject(env, scaled, proxy));
+    }
+    
+    return result;
+}
+
+Napi::Object NdiReceiver::FullVideoFrameToObject(Napi::Env env, const NDIlib_video_frame_v2_t& videoFrame) {
+    NDIlib_video_frame_v2_t converted;
+    NdiUtils::FramePayload payload;
+    NdiConvert::ConvertOptions convertOptions;
+    convertOptions.dither = m_videoOptions.dither;
+    
+    if (m_videoOptions.convertTo &&
+        NdiConvert::ConvertVideoFrame(videoFrame, m_videoOptions.convertTo, converted, payload, convertOptions)) {
+        Napi::Object result = NdiUtils::VideoFrameToObject(env, converted, payload);
+        NDIlib_recv_free_video_v2(m_receiver, &videoFrame);
+        return result;
+    }
+    
+    if (m_videoOptions.zeroCopy) {
+        // Keep the receiver alive until the frame is handed back to NDI
+        RecvHandle receiver = m_handle;
+        return NdiUtils::VideoFrameToObject(env, videoFrame, [receiver, videoFrame]() {
+            NDIlib_recv_free_video_v2(receiver.get(), &videoFrame);
+        });
+    }
+    
+    Napi::Object result = NdiUtils::VideoFrameToObject(env, videoFrame);
+    NDIlib_recv_free_video_v2(m_receiver, &videoFrame);
+    return result;
+}
+
+bool NdiReceiver::CheckCaptureIdle(Napi::Env env) {
+    // Both would call NDIlib_recv_capture_v2 and split the frames between them
+    if ((m_captureThread && m_captureThread->IsRunning()) || m_mailbox) {
+        Napi::Error::New(env, "Capture thread is running").ThrowAsJavaScriptException();
+        return false;
+    }
+    return true;
+}
+
 Napi::Value NdiReceiver::SetTally(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
@@ -592,7 +938,13 @@ Napi::Value NdiReceiver::Destroy(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
     if (m_receiver && !m_destroyed) {
-        NDIlib_recv_destroy(m_receiver);
+        m_captureThread.reset();
+        m_mailbox.reset();
+        m_latestVideo.Reset();
+        
+        // The NDI instance itself goes away once in-flight captures and
+        // zero-copy frames have been released
+        m_handle.reset();
         m_receiver = nullptr;
         m_destroyed = true;
     }
@@ -613,12 +965,16 @@ Napi::Value NdiReceiver::CaptureAsync(const Napi::CallbackInfo& info) {
         return env.Null();
     }
     
+    if (!CheckCaptureIdle(env)) {
+        return env.Null();
+    }
+    
     uint32_t timeout = 1000;
     if (info.Length() > 0 && info[0].IsNumber()) {
         timeout = info[0].As<Napi::Number>().Uint32Value();
     }
     
-    CaptureWorker* worker = new CaptureWorker(env, m_receiver, timeout);
+    CaptureWorker* worker = new CaptureWorker(env, m_handle, timeout, m_videoOptions);
     Napi::Promise promise = worker->m_deferred.Promise();
     worker->Queue();
     
@@ -633,12 +989,16 @@ Napi::Value NdiReceiver::CaptureVideoAsync(const Napi::CallbackInfo& info) {
         return env.Null();
     }
     
+    if (!CheckCaptureIdle(env)) {
+        return env.Null();
+    }
+    
     uint32_t timeout = 1000;
     if (info.Length() > 0 && info[0].IsNumber()) {
         timeout = info[0].As<Napi::Number>().Uint32Value();
     }
     
-    CaptureVideoWorker* worker = new CaptureVideoWorker(env, m_receiver, timeout);
+    CaptureVideoWorker* worker = new CaptureVideoWorker(env, m_handle, timeout, m_videoOptions);
     Napi::Promise promise = worker->m_deferred.Promise();
     worker->Queue();
     
@@ -653,14 +1013,363 @@ Napi::Value NdiReceiver::CaptureAudioAsync(const Napi::CallbackInfo& info) {
         return env.Null();
     }
     
+    if (!CheckCaptureIdle(env)) {
+        return env.Null();
+    }
+    
     uint32_t timeout = 1000;
     if (info.Length() > 0 && info[0].IsNumber()) {
         timeout = info[0].As<Napi::Number>().Uint32Value();
     }
     
-    CaptureAudioWorker* worker = new CaptureAudioWorker(env, m_receiver, timeout);
+    CaptureAudioWorker* worker = new CaptureAudioWorker(env, m_handle, timeout);
+    Napi::Promise promise = worker->m_deferred.Promise();
+    worker->Queue();
+    
+    return promise;
+}
+
+Napi::Value NdiReceiver::CaptureVideoIntoAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_receiver || m_destroyed) {
+        Napi::Error::New(env, "Receiver has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (!CheckCaptureIdle(env)) {
+        return env.Null();
+    }
+    
+    if (info.Length() < 1 || !info[0].IsTypedArray()) {
+        Napi::TypeError::New(env, "Expected target Buffer").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    uint32_t timeout = 1000;
+    if (info.Length() > 1 && info[1].IsNumber()) {
+        timeout = info[1].As<Napi::Number>().Uint32Value();
+    }
+    
+    CaptureVideoIntoWorker* worker = new CaptureVideoIntoWorker(
+        env, m_handle, info[0].As<Napi::TypedArray>(), timeout
+    );
     Napi::Promise promise = worker->m_deferred.Promise();
     worker->Queue();
     
     return promise;
 }
+
+Napi::Value NdiReceiver::CaptureAudioIntoAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_receiver || m_destroyed) {
+        Napi::Error::New(env, "Receiver has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (!CheckCaptureIdle(env)) {
+        return env.Null();
+    }
+    
+    if (info.Length() < 1 || !info[0].IsTypedArray() ||
+        info[0].As<Napi::TypedArray>().TypedArrayType() != napi_float32_array) {
+        Napi::TypeError::New(env, "Expected target Float32Array").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    uint32_t timeout = 1000;
+    if (info.Length() > 1 && info[1].IsNumber()) {
+        timeout = info[1].As<Napi::Number>().Uint32Value();
+    }
+    
+    CaptureAudioIntoWorker* worker = new CaptureAudioIntoWorker(
+        env, m_handle, info[0].As<Napi::Float32Array>(), timeout
+    );
+    Napi::Promise promise = worker->m_deferred.Promise();
+    worker->Queue();
+    
+    return promise;
+}
+
+// Convert capture thread queue counters to a JavaScript object
+static Napi::Object QueueStatsToObject(Napi::Env env, const NdiCaptureThread::QueueStats& stats) {
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("enqueued", Napi::Number::New(env, static_cast<double>(stats.enqueued)));
+    obj.Set("dropped", Napi::Number::New(env, static_cast<double>(stats.dropped)));
+    obj.Set("highWaterMark", Napi::Number::New(env, static_cast<double>(stats.highWaterMark)));
+    obj.Set("depth", Napi::Number::New(env, static_cast<double>(stats.depth)));
+    obj.Set("capacity", Napi::Number::New(env, static_cast<double>(stats.capacity)));
+    return obj;
+}
+
+// Parse a frame type list such as ['video', 'audio'] into CaptureTypes bits
+static bool ParseCaptureTypes(Napi::Env env, Napi::Value value, unsigned& types) {
+    if (!value.IsArray()) {
+        Napi::TypeError::New(env, "Expected types to be an array").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    Napi::Array array = value.As<Napi::Array>();
+    types = 0;
+    
+    for (uint32_t i = 0; i < array.Length(); i++) {
+        Napi::Value entry = array.Get(i);
+        std::string type = entry.IsString() ? entry.As<Napi::String>().Utf8Value() : "";
+        
+        if (type == "video") {
+            types |= CaptureTypeVideo;
+        } else if (type == "audio") {
+            types |= CaptureTypeAudio;
+        } else if (type == "metadata") {
+            types |= CaptureTypeMetadata;
+        } else {
+            Napi::TypeError::New(env, "Unknown frame type: " + type).ThrowAsJavaScriptException();
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+Napi::Value NdiReceiver::StartCaptureThread(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_receiver || m_destroyed) {
+        Napi::Error::New(env, "Receiver has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (info.Length() < 1 || !info[0].IsFunction()) {
+        Napi::TypeError::New(env, "Expected frame callback function").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (m_captureThread && m_captureThread->IsRunning()) {
+        Napi::Error::New(env, "Capture thread is already running").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (m_mailbox) {
+        Napi::Error::New(env, "Latest-frame capture is running").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    NdiCaptureThread::Options threadOptions;
+    
+    if (info.Length() > 1 && info[1].IsNumber()) {
+        threadOptions.timeout = info[1].As<Napi::Number>().Uint32Value();
+    } else if (info.Length() > 1 && info[1].IsObject()) {
+        Napi::Object options = info[1].As<Napi::Object>();
+        
+        if (options.Has("timeout") && options.Get("timeout").IsNumber()) {
+            threadOptions.timeout = options.Get("timeout").As<Napi::Number>().Uint32Value();
+        }
+        
+        if (options.Has("queueDepth") && options.Get("queueDepth").IsNumber()) {
+            size_t depth = options.Get("queueDepth").As<Napi::Number>().Uint32Value();
+            threadOptions.videoDepth = depth;
+            threadOptions.audioDepth = depth;
+            threadOptions.metadataDepth = depth;
+        } else if (options.Has("queueDepth") && options.Get("queueDepth").IsObject()) {
+            Napi::Object depths = options.Get("queueDepth").As<Napi::Object>();
+            
+            if (depths.Has("video") && depths.Get("video").IsNumber()) {
+                threadOptions.videoDepth = depths.Get("video").As<Napi::Number>().Uint32Value();
+            }
+            if (depths.Has("audio") && depths.Get("audio").IsNumber()) {
+                threadOptions.audioDepth = depths.Get("audio").As<Napi::Number>().Uint32Value();
+            }
+            if (depths.Has("metadata") && depths.Get("metadata").IsNumber()) {
+                threadOptions.metadataDepth = depths.Get("metadata").As<Napi::Number>().Uint32Value();
+            }
+        }
+        
+        if (options.Has("dropPolicy") && options.Get("dropPolicy").IsString()) {
+            std::string policy = options.Get("dropPolicy").As<Napi::String>().Utf8Value();
+            
+            if (policy == "drop-oldest") {
+                threadOptions.dropPolicy = NdiCaptureThread::DropOldest;
+            } else if (policy == "drop-newest") {
+                threadOptions.dropPolicy = NdiCaptureThread::DropNewest;
+            } else if (policy == "block") {
+                threadOptions.dropPolicy = NdiCaptureThread::Block;
+            } else {
+                Napi::TypeError::New(env, "Expected dropPolicy 'drop-oldest', 'drop-newest' or 'block'").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+        }
+        
+        if (options.Has("types") && !ParseCaptureTypes(env, options.Get("types"), threadOptions.types)) {
+            return env.Null();
+        }
+    }
+    
+    m_captureThread.reset(new NdiCaptureThread(
+        env, info[0].As<Napi::Function>(), m_handle, threadOptions, m_videoOptions
+    ));
+    
+    return env.Undefined();
+}
+
+Napi::Value NdiReceiver::StartFrameQueue(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_receiver || m_destroyed) {
+        Napi::Error::New(env, "Receiver has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (m_captureThread && m_captureThread->IsRunning()) {
+        Napi::Error::New(env, "Capture thread is already running").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (m_mailbox) {
+        Napi::Error::New(env, "Latest-frame capture is running").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    // Capture stops while highWaterMark frames are waiting to be taken
+    NdiCaptureThread::Options threadOptions;
+    threadOptions.videoDepth = 8;
+    threadOptions.dropPolicy = NdiCaptureThread::Block;
+    
+    if (info.Length() > 0 && info[0].IsObject()) {
+        Napi::Object options = info[0].As<Napi::Object>();
+        
+        if (options.Has("timeout") && options.Get("timeout").IsNumber()) {
+            threadOptions.timeout = options.Get("timeout").As<Napi::Number>().Uint32Value();
+        }
+        
+        if (options.Has("highWaterMark") && options.Get("highWaterMark").IsNumber()) {
+            threadOptions.videoDepth = options.Get("highWaterMark").As<Napi::Number>().Uint32Value();
+        }
+        
+        if (options.Has("types") && !ParseCaptureTypes(env, options.Get("types"), threadOptions.types)) {
+            return env.Null();
+        }
+    }
+    
+    m_captureThread.reset(new NdiCaptureThread(env, m_handle, threadOptions, m_videoOptions));
+    
+    return env.Undefined();
+}
+
+Napi::Value NdiReceiver::NextFrame(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_captureThread) {
+        Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+        deferred.Resolve(env.Null());
+        return deferred.Promise();
+    }
+    
+    return m_captureThread->Next(env);
+}
+
+Napi::Value NdiReceiver::StopCaptureThread(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    // Keep the stopped thread around so its counters stay readable
+    if (m_captureThread) {
+        m_captureThread->Stop();
+    }
+    
+    return env.Undefined();
+}
+
+Napi::Value NdiReceiver::PauseCaptureThread(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_captureThread || !m_captureThread->IsRunning()) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    m_captureThread->Pause();
+    return Napi::Boolean::New(env, true);
+}
+
+Napi::Value NdiReceiver::ResumeCaptureThread(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_captureThread || !m_captureThread->IsRunning()) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    m_captureThread->Resume();
+    return Napi::Boolean::New(env, true);
+}
+
+Napi::Value NdiReceiver::GetCaptureStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_captureThread) {
+        return env.Null();
+    }
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("video", QueueStatsToObject(env, m_captureThread->GetQueueStats(NDIlib_frame_type_video)));
+    result.Set("audio", QueueStatsToObject(env, m_captureThread->GetQueueStats(NDIlib_frame_type_audio)));
+    result.Set("metadata", QueueStatsToObject(env, m_captureThread->GetQueueStats(NDIlib_frame_type_metadata)));
+    return result;
+}
+
+Napi::Value NdiReceiver::StartLatestVideo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_receiver || m_destroyed) {
+        Napi::Error::New(env, "Receiver has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (m_mailbox) {
+        Napi::Error::New(env, "Latest-frame capture is already running").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    // Both would call NDIlib_recv_capture_v2 and split the frames between them
+    if (m_captureThread && m_captureThread->IsRunning()) {
+        Napi::Error::New(env, "Capture thread is running").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    uint32_t timeout = 100;
+    if (info.Length() > 0 && info[0].IsNumber()) {
+        timeout = info[0].As<Napi::Number>().Uint32Value();
+    }
+    
+    m_mailbox.reset(new NdiFrameMailbox(m_handle, timeout, m_videoOptions));
+    
+    return env.Undefined();
+}
+
+Napi::Value NdiReceiver::StopLatestVideo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    m_mailbox.reset();
+    m_latestVideo.Reset();
+    
+    return env.Undefined();
+}
+
+Napi::Value NdiReceiver::GetLatestVideo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_mailbox) {
+        return env.Null();
+    }
+    
+    // Only a frame newer than the last call is converted; otherwise the
+    // previous object is returned again
+    std::unique_ptr<CapturedVideoFrame> frame = m_mailbox->TakeLatest();
+    if (frame) {
+        m_latestVideo.Reset(CapturedVideoToObject(env, *frame), 1);
+    }
+    
+    if (m_latestVideo.IsEmpty()) {
+        return env.Null();
+    }
+    
+    return m_latestVideo.Value();
+}
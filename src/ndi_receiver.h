@@ -25,6 +25,10 @@
 
 #include <napi.h>
 #include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include "ndi_async.h"
+#include "ndi_capture_thread.h"
+#include "ndi_frame_mailbox.h"
+#include <memory>
 
 class NdiReceiver : public Napi::ObjectWrap<NdiReceiver> {
 public:
@@ -44,6 +48,10 @@ private:
     Napi::Value Capture(const Napi::CallbackInfo& info);
     Napi::Value CaptureVideo(const Napi::CallbackInfo& info);
     Napi::Value CaptureAudio(const Napi::CallbackInfo& info);
+    Napi::Value CaptureVideoInto(const Napi::CallbackInfo& info);
+    Napi::Value CaptureAudioInto(const Napi::CallbackInfo& info);
+    Napi::Value CaptureVideoPacked(const Napi::CallbackInfo& info);
+    Napi::Value CaptureAudioPacked(const Napi::CallbackInfo& info);
     Napi::Value SetTally(const Napi::CallbackInfo& info);
     Napi::Value SendMetadata(const Napi::CallbackInfo& info);
     Napi::Value PtzIsSupported(const Napi::CallbackInfo& info);
@@ -69,10 +77,41 @@ private:
     Napi::Value CaptureAsync(const Napi::CallbackInfo& info);
     Napi::Value CaptureVideoAsync(const Napi::CallbackInfo& info);
     Napi::Value CaptureAudioAsync(const Napi::CallbackInfo& info);
+    Napi::Value CaptureVideoIntoAsync(const Napi::CallbackInfo& info);
+    Napi::Value CaptureAudioIntoAsync(const Napi::CallbackInfo& info);
+    
+    // Native capture thread
+    Napi::Value StartCaptureThread(const Napi::CallbackInfo& info);
+    Napi::Value StopCaptureThread(const Napi::CallbackInfo& info);
+    Napi::Value PauseCaptureThread(const Napi::CallbackInfo& info);
+    Napi::Value ResumeCaptureThread(const Napi::CallbackInfo& info);
+    Napi::Value GetCaptureStats(const Napi::CallbackInfo& info);
+    
+    // Pull-based capture backing the async frame iterator
+    Napi::Value StartFrameQueue(const Napi::CallbackInfo& info);
+    Napi::Value NextFrame(const Napi::CallbackInfo& info);
+    
+    // Latest-frame video capture
+    Napi::Value StartLatestVideo(const Napi::CallbackInfo& info);
+    Napi::Value StopLatestVideo(const Napi::CallbackInfo& info);
+    Napi::Value GetLatestVideo(const Napi::CallbackInfo& info);
+    
+    // Convert a captured video frame, copying or converting it, or handing it
+    // over in zero-copy mode, with its downscaled proxy if one was asked for
+    Napi::Object VideoFrameToObject(Napi::Env env, const NDIlib_video_frame_v2_t& videoFrame);
+    Napi::Object FullVideoFrameToObject(Napi::Env env, const NDIlib_video_frame_v2_t& videoFrame);
+    
+    // Throws unless no capture thread or latest-frame capture is running
+    bool CheckCaptureIdle(Napi::Env env);
     
     // Internal state
     NDIlib_recv_instance_t m_receiver;
+    RecvHandle m_handle;
     bool m_destroyed;
+    VideoCaptureOptions m_videoOptions;
+    std::unique_ptr<NdiCaptureThread> m_captureThread;
+    std::unique_ptr<NdiFrameMailbox> m_mailbox;
+    Napi::ObjectReference m_latestVideo;
 };
 
 #endif // NDI_RECEIVER_H
@@ -0,0 +1,131 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Ring Buffer - Lock-free bounded queue for handing frames between threads
+ */
+
+#ifndef NDI_RING_BUFFER_H
+#define NDI_RING_BUFFER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+/**
+ * Bounded lock-free queue (Vyukov's sequence-per-slot design). One producer
+ * and one consumer is the normal case, but either side may also pop, which
+ * lets a producer discard the oldest entry when the consumer falls behind.
+ */
+template <typename T>
+class NdiRingBuffer {
+public:
+    explicit NdiRingBuffer(size_t capacity)
+        : m_depth(capacity > 0 ? capacity : 1),
+          m_capacity(std::max<size_t>(m_depth, 2)),
+          m_cells(new Cell[m_capacity]),
+          m_enqueuePos(0),
+          m_dequeuePos(0) {
+        for (size_t i = 0; i < m_capacity; i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    
+    NdiRingBuffer(const NdiRingBuffer&) = delete;
+    NdiRingBuffer& operator=(const NdiRingBuffer&) = delete;
+    
+    // Move value into the queue, returns false (leaving value untouched) when full
+    bool TryPush(T& value) {
+        if (Size() >= m_depth) {
+            return false;
+        }
+        
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        
+        while (true) {
+            Cell& cell = m_cells[pos % m_capacity];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    
+    // Move the oldest entry into value, returns false when empty
+    bool TryPop(T& value) {
+        size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        
+        while (true) {
+            Cell& cell = m_cells[pos % m_capacity];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            
+            if (diff == 0) {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.sequence.store(pos + m_capacity, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    
+    // Approximate number of entries, exact when no push or pop is in flight
+    size_t Size() const {
+        size_t enqueued = m_enqueuePos.load(std::memory_order_acquire);
+        size_t dequeued = m_dequeuePos.load(std::memory_order_acquire);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+    
+    size_t Capacity() const { return m_depth; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+    
+    // A single cell would hand a popped slot the very sequence a waiting
+    // producer expects, so at least two cells back even a depth of one
+    const size_t m_depth;
+    const size_t m_capacity;
+    std::unique_ptr<Cell[]> m_cells;
+    
+    // Producer and consumer positions live on separate cache lines
+    alignas(64) std::atomic<size_t> m_enqueuePos;
+    alignas(64) std::atomic<size_t> m_dequeuePos;
+};
+
+#endif // NDI_RING_BUFFER_H
@@ -0,0 +1,523 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Scale - Implementation
+ */
+
+#include "ndi_scale.h"
+#include "ndi_frame_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace NdiScale {
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+
+// ============================================================================
+// Filters
+// ============================================================================
+
+// Half-width of each filter at 1:1, in source samples
+double FilterSupport(Filter filter) {
+    switch (filter) {
+        case FilterBilinear:
+            return 1.0;
+        case FilterLanczos:
+            return 3.0;
+        default:
+            return 0.5;
+    }
+}
+
+double Sinc(double x) {
+    if (x == 0.0) {
+        return 1.0;
+    }
+    x *= kPi;
+    return std::sin(x) / x;
+}
+
+double FilterWeight(Filter filter, double x) {
+    switch (filter) {
+        case FilterBilinear:
+            x = std::fabs(x);
+            return x < 1.0 ? 1.0 - x : 0.0;
+        case FilterLanczos:
+            return x > -3.0 && x < 3.0 ? Sinc(x) * Sinc(x / 3.0) : 0.0;
+        default:
+            return x > -0.5 && x <= 0.5 ? 1.0 : 0.0;
+    }
+}
+
+/**
+ * Which source samples make up each output sample, and by how much. When
+ * shrinking, the filter is stretched by the scale factor so that every
+ * source sample contributes (an area average for the box filter), which is
+ * what keeps thumbnails free of aliasing.
+ */
+struct Taps {
+    int stride;
+    std::vector<int> start;
+    std::vector<int> count;
+    std::vector<float> weights;
+};
+
+void ComputeTaps(int in, int out, Filter filter, Taps& taps) {
+    double scale = static_cast<double>(in) / out;
+    double filterScale = std::max(scale, 1.0);
+    double support = FilterSupport(filter) * filterScale;
+    
+    taps.stride = static_cast<int>(std::ceil(support)) * 2 + 1;
+    taps.start.assign(out, 0);
+    taps.count.assign(out, 0);
+    taps.weights.assign(static_cast<size_t>(out) * taps.stride, 0.0f);
+    
+    std::vector<double> weights(taps.stride);
+    
+    for (int i = 0; i < out; i++) {
+        double center = (i + 0.5) * scale;
+        int first = std::max(0, static_cast<int>(center - support + 0.5));
+        int last = std::min(in, static_cast<int>(center + support + 0.5));
+        int count = std::min(last - first, taps.stride);
+        
+        double total = 0.0;
+        for (int k = 0; k < count; k++) {
+            weights[k] = FilterWeight(filter, (first + k + 0.5 - center) / filterScale);
+            total += weights[k];
+        }
+        
+        // Only possible for degenerate sizes; fall back to the nearest sample
+        if (total == 0.0 || count <= 0) {
+            first = std::min(in - 1, static_cast<int>(center));
+            count = 1;
+            weights[0] = total = 1.0;
+        }
+        
+        taps.start[i] = first;
+        taps.count[i] = count;
+        for (int k = 0; k < count; k++) {
+            taps.weights[static_cast<size_t>(i) * taps.stride + k] = static_cast<float>(weights[k] / total);
+        }
+    }
+}
+
+// ============================================================================
+// Frame layouts
+// ============================================================================
+
+// Samples of one colour channel within a row: first, first + step, ...
+struct Channel {
+    int first;
+    int step;
+    int count;
+};
+
+// Rows of interleaved channels, resampled vertically as a whole and then
+// horizontally a channel at a time
+struct Plane {
+    size_t offset;
+    int stride;
+    int rows;
+    int samples;
+    int channelCount;
+    Channel channels[4];
+};
+
+struct Layout {
+    int planeCount;
+    Plane planes[3];
+    
+    // 16-bit samples rather than bytes
+    bool wide;
+};
+
+Plane MakePlane(size_t offset, int stride, int rows, int samples) {
+    Plane plane = {};
+    plane.offset = offset;
+    plane.stride = stride;
+    plane.rows = rows;
+    plane.samples = samples;
+    return plane;
+}
+
+void AddChannel(Plane& plane, int first, int step, int count) {
+    plane.channels[plane.channelCount++] = Channel{ first, step, count };
+}
+
+bool IsRgb(NDIlib_FourCC_video_type_e fourCC) {
+    return fourCC == NDIlib_FourCC_video_type_BGRA || fourCC == NDIlib_FourCC_video_type_BGRX ||
+           fourCC == NDIlib_FourCC_video_type_RGBA || fourCC == NDIlib_FourCC_video_type_RGBX;
+}
+
+bool Is420(NDIlib_FourCC_video_type_e fourCC) {
+    return fourCC == NDIlib_FourCC_video_type_I420 || fourCC == NDIlib_FourCC_video_type_YV12 ||
+           fourCC == NDIlib_FourCC_video_type_NV12;
+}
+
+/**
+ * The planes and channels of a frame, laid out as NDI expects: UYVA alpha
+ * follows at half the UYVY stride and PA16 alpha at the full stride, 4:2:0
+ * chroma follows luma at half the stride (NV12: interleaved at the full
+ * stride), P216 UV follows luma at the same stride. Resampling a plane the same way whichever channel it
+ * holds means I420 and YV12 need no distinction.
+ */
+bool GetLayout(NDIlib_FourCC_video_type_e fourCC, int xres, int yres, int stride, Layout& layout) {
+    layout = Layout();
+    size_t plane = static_cast<size_t>(stride) * yres;
+    
+    if (IsRgb(fourCC)) {
+        Plane& rgb = layout.planes[layout.planeCount++] = MakePlane(0, stride, yres, xres * 4);
+        for (int c = 0; c < 4; c++) {
+            AddChannel(rgb, c, 4, xres);
+        }
+        return true;
+    }
+    
+    if (fourCC == NDIlib_FourCC_video_type_UYVY || fourCC == NDIlib_FourCC_video_type_UYVA) {
+        Plane& uyvy = layout.planes[layout.planeCount++] = MakePlane(0, stride, yres, xres * 2);
+        AddChannel(uyvy, 1, 2, xres);
+        AddChannel(uyvy, 0, 4, xres / 2);
+        AddChannel(uyvy, 2, 4, xres / 2);
+        
+        if (fourCC == NDIlib_FourCC_video_type_UYVA) {
+            Plane& alpha = layout.planes[layout.planeCount++] = MakePlane(plane, stride / 2, yres, xres);
+            AddChannel(alpha, 0, 1, xres);
+        }
+        return true;
+    }
+    
+    if (Is420(fourCC)) {
+        if ((yres & 1) != 0 || (stride & 1) != 0) {
+            return false;
+        }
+        
+        Plane& luma = layout.planes[layout.planeCount++] = MakePlane(0, stride, yres, xres);
+        AddChannel(luma, 0, 1, xres);
+        
+        if (fourCC == NDIlib_FourCC_video_type_NV12) {
+            Plane& uv = layout.planes[layout.planeCount++] = MakePlane(plane, stride, yres / 2, xres);
+            AddChannel(uv, 0, 2, xres / 2);
+            AddChannel(uv, 1, 2, xres / 2);
+            return true;
+        }
+        
+        size_t chroma = static_cast<size_t>(stride / 2) * (yres / 2);
+        for (int i = 0; i < 2; i++) {
+            Plane& c = layout.planes[layout.planeCount++] = MakePlane(plane + chroma * i, stride / 2, yres / 2, xres / 2);
+            AddChannel(c, 0, 1, xres / 2);
+        }
+        return true;
+    }
+    
+    if (fourCC == NDIlib_FourCC_video_type_P216 || fourCC == NDIlib_FourCC_video_type_PA16) {
+        if ((stride & 1) != 0) {
+            return false;
+        }
+        
+        layout.wide = true;
+        Plane& luma = layout.planes[layout.planeCount++] = MakePlane(0, stride, yres, xres);
+        AddChannel(luma, 0, 1, xres);
+        
+        Plane& uv = layout.planes[layout.planeCount++] = MakePlane(plane, stride, yres, xres);
+        AddChannel(uv, 0, 2, xres / 2);
+        AddChannel(uv, 1, 2, xres / 2);
+        
+        if (fourCC == NDIlib_FourCC_video_type_PA16) {
+            Plane& alpha = layout.planes[layout.planeCount++] = MakePlane(plane * 2, stride, yres, xres);
+            AddChannel(alpha, 0, 1, xres);
+        }
+        return true;
+    }
+    
+    return false;
+}
+
+// ============================================================================
+// Resampling
+// ============================================================================
+
+template <typename T>
+inline T Saturate(float value) {
+    const float max = static_cast<float>(std::numeric_limits<T>::max());
+    return static_cast<T>(std::min(max, std::max(0.0f, value + 0.5f)));
+}
+
+/**
+ * Resample one plane. Each output row is first blended from its source rows
+ * across every sample, which the compiler vectorizes whatever the channel
+ * layout, then each channel is filtered along the row.
+ */
+template <typename T>
+void ScalePlane(const Plane& in, const uint8_t* src, const Plane& out, uint8_t* dst, Filter filter) {
+    Taps vertical;
+    ComputeTaps(in.rows, out.rows, filter, vertical);
+    
+    Taps horizontal[4];
+    for (int c = 0; c < in.channelCount; c++) {
+        ComputeTaps(in.channels[c].count, out.channels[c].count, filter, horizontal[c]);
+    }
+    
+    std::vector<float> row(in.samples);
+    
+    for (int y = 0; y < out.rows; y++) {
+        std::fill(row.begin(), row.end(), 0.0f);
+        
+        const float* weights = &vertical.weights[static_cast<size_t>(y) * vertical.stride];
+        for (int k = 0; k < vertical.count[y]; k++) {
+            const T* line = reinterpret_cast<const T*>(
+                src + in.offset + static_cast<size_t>(vertical.start[y] + k) * in.stride);
+            float weight = weights[k];
+            for (int x = 0; x < in.samples; x++) {
+                row[x] += weight * line[x];
+            }
+        }
+        
+        T* outLine = reinterpret_cast<T*>(dst + out.offset + static_cast<size_t>(y) * out.stride);
+        
+        for (int c = 0; c < in.channelCount; c++) {
+            const Channel& from = in.channels[c];
+            const Channel& to = out.channels[c];
+            const Taps& taps = horizontal[c];
+            
+            for (int x = 0; x < to.count; x++) {
+                const float* w = &taps.weights[static_cast<size_t>(x) * taps.stride];
+                const float* samples = row.data() + from.first + static_cast<size_t>(taps.start[x]) * from.step;
+                
+                float sum = 0.0f;
+                for (int k = 0; k < taps.count[x]; k++) {
+                    sum += w[k] * samples[k * from.step];
+                }
+                outLine[to.first + x * to.step] = Saturate<T>(sum);
+            }
+        }
+    }
+}
+
+int RoundToEven(double value) {
+    return std::max(2, static_cast<int>(std::lround(value / 2)) * 2);
+}
+
+/**
+ * Output size for a frame, never larger than the source as this only
+ * downscales. Widths are even, as pixel pairs share chroma, and so are
+ * 4:2:0 heights.
+ */
+bool TargetSize(NDIlib_FourCC_video_type_e fourCC, const ScaleOptions& options, int xres, int yres, int& width, int& height) {
+    double w;
+    double h;
+    
+    if (options.width > 0 || options.height > 0) {
+        w = options.width > 0 ? options.width : static_cast<double>(options.height) * xres / yres;
+        h = options.height > 0 ? options.height : static_cast<double>(options.width) * yres / xres;
+    } else if (options.scale > 0) {
+        w = xres * options.scale;
+        h = yres * options.scale;
+    } else {
+        return false;
+    }
+    
+    w = std::min(w, static_cast<double>(xres / 2 * 2));
+    h = std::min(h, static_cast<double>(Is420(fourCC) ? yres / 2 * 2 : yres));
+    
+    width = RoundToEven(w);
+    height = Is420(fourCC) ? RoundToEven(h) : std::max(1, static_cast<int>(std::lround(h)));
+    return true;
+}
+
+Filter StringToFilter(const std::string& name, bool& ok) {
+    ok = true;
+    if (name == "box") return FilterBox;
+    if (name == "bilinear") return FilterBilinear;
+    if (name == "lanczos") return FilterLanczos;
+    ok = false;
+    return FilterBox;
+}
+
+Napi::Value ScaleVideo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsObject() || !info[1].IsObject()) {
+        Napi::TypeError::New(env, "Expected video frame object and scale options").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object frameObj = info[0].As<Napi::Object>();
+    
+    if (!frameObj.Has("data") || !frameObj.Get("data").IsBuffer() ||
+        !frameObj.Get("xres").IsNumber() || !frameObj.Get("yres").IsNumber() ||
+        !frameObj.Get("fourCC").IsString()) {
+        Napi::TypeError::New(env, "Video frame needs xres, yres, fourCC and a data Buffer").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    ScaleOptions options;
+    if (!ParseScaleOptions(env, info[1].As<Napi::Object>(), options)) {
+        return env.Null();
+    }
+    
+    Napi::Buffer<uint8_t> data = frameObj.Get("data").As<Napi::Buffer<uint8_t>>();
+    
+    NDIlib_video_frame_v2_t frame = {};
+    frame.xres = frameObj.Get("xres").As<Napi::Number>().Int32Value();
+    frame.yres = frameObj.Get("yres").As<Napi::Number>().Int32Value();
+    frame.FourCC = NdiUtils::StringToFourCC(frameObj.Get("fourCC").As<Napi::String>().Utf8Value());
+    frame.line_stride_in_bytes = NdiUtils::DefaultLineStride(frame.FourCC, frame.xres);
+    frame.p_data = data.Data();
+    
+    // Frames built for sending name it lineStrideInBytes, captured ones lineStride
+    if (frameObj.Has("lineStrideInBytes") && frameObj.Get("lineStrideInBytes").IsNumber()) {
+        frame.line_stride_in_bytes = frameObj.Get("lineStrideInBytes").As<Napi::Number>().Int32Value();
+    } else if (frameObj.Has("lineStride") && frameObj.Get("lineStride").IsNumber()) {
+        frame.line_stride_in_bytes = frameObj.Get("lineStride").As<Napi::Number>().Int32Value();
+    }
+    
+    if (!CanScale(frame.FourCC)) {
+        Napi::Error::New(env, "Cannot scale " + NdiUtils::FourCCToString(frame.FourCC) + " video").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (frame.xres <= 0 || frame.yres <= 0 || (frame.xres & 1) != 0 ||
+        frame.line_stride_in_bytes < NdiUtils::DefaultLineStride(frame.FourCC, frame.xres) ||
+        NdiUtils::VideoFrameDataSize(frame) > data.Length()) {
+        Napi::Error::New(env, "Video frame needs a positive even width and data covering its size and line stride")
+            .ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    NDIlib_video_frame_v2_t scaled;
+    NdiUtils::FramePayload payload;
+    
+    if (!ScaleVideoFrame(frame, options, scaled, payload)) {
+        Napi::Error::New(env, "Video frame height or line stride does not suit the planes of " +
+                         NdiUtils::FourCCToString(frame.FourCC)).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("xres", Napi::Number::New(env, scaled.xres));
+    result.Set("yres", Napi::Number::New(env, scaled.yres));
+    result.Set("fourCC", Napi::String::New(env, NdiUtils::FourCCToString(scaled.FourCC)));
+    result.Set("lineStrideInBytes", Napi::Number::New(env, scaled.line_stride_in_bytes));
+    result.Set("data", payload.ToBuffer(env));
+    
+    return result;
+}
+
+} // namespace
+
+bool ParseScaleOptions(Napi::Env env, const Napi::Object& object, ScaleOptions& options) {
+    ScaleOptions parsed;
+    
+    if (object.Has("width") && object.Get("width").IsNumber()) {
+        parsed.width = object.Get("width").As<Napi::Number>().Int32Value();
+    }
+    
+    if (object.Has("height") && object.Get("height").IsNumber()) {
+        parsed.height = object.Get("height").As<Napi::Number>().Int32Value();
+    }
+    
+    if (object.Has("scale") && object.Get("scale").IsNumber()) {
+        parsed.scale = object.Get("scale").As<Napi::Number>().DoubleValue();
+    }
+    
+    if (parsed.width < 0 || parsed.height < 0 || !(parsed.scale >= 0 && parsed.scale <= 1)) {
+        Napi::RangeError::New(env, "Scale width and height must be positive and scale between 0 and 1")
+            .ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    if (!parsed.Enabled()) {
+        Napi::TypeError::New(env, "Scale options need a width, height or scale").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    if (object.Has("filter") && object.Get("filter").IsString()) {
+        bool ok;
+        parsed.filter = StringToFilter(object.Get("filter").As<Napi::String>().Utf8Value(), ok);
+        
+        if (!ok) {
+            Napi::TypeError::New(env, "filter must be 'box', 'bilinear' or 'lanczos'").ThrowAsJavaScriptException();
+            return false;
+        }
+    }
+    
+    options = parsed;
+    return true;
+}
+
+bool CanScale(NDIlib_FourCC_video_type_e fourCC) {
+    Layout layout;
+    return GetLayout(fourCC, 2, 2, NdiUtils::DefaultLineStride(fourCC, 2), layout);
+}
+
+bool ScaleVideoFrame(
+    const NDIlib_video_frame_v2_t& frame,
+    const ScaleOptions& options,
+    NDIlib_video_frame_v2_t& scaled,
+    NdiUtils::FramePayload& payload
+) {
+    int width;
+    int height;
+    Layout in;
+    Layout out;
+    
+    if (!frame.p_data || frame.xres <= 0 || frame.yres <= 0 || (frame.xres & 1) != 0 ||
+        !TargetSize(frame.FourCC, options, frame.xres, frame.yres, width, height) ||
+        !GetLayout(frame.FourCC, frame.xres, frame.yres, frame.line_stride_in_bytes, in)) {
+        return false;
+    }
+    
+    int stride = NdiUtils::DefaultLineStride(frame.FourCC, width);
+    GetLayout(frame.FourCC, width, height, stride, out);
+    
+    NDIlib_video_frame_v2_t header = frame;
+    header.xres = width;
+    header.yres = height;
+    header.line_stride_in_bytes = stride;
+    
+    NdiFramePool::AcquirePayload(
+        NdiFramePool::FrameKey{ width, height, stride, static_cast<uint32_t>(frame.FourCC) },
+        NdiUtils::VideoFrameDataSize(header),
+        payload
+    );
+    
+    for (int i = 0; i < in.planeCount; i++) {
+        if (in.wide) {
+            ScalePlane<uint16_t>(in.planes[i], frame.p_data, out.planes[i], payload.data, options.filter);
+        } else {
+            ScalePlane<uint8_t>(in.planes[i], frame.p_data, out.planes[i], payload.data, options.filter);
+        }
+    }
+    
+    // The picture keeps its display aspect ratio, only with fewer pixels
+    scaled = header;
+    scaled.p_data = payload.data;
+    return true;
+}
+
+void Init(Napi::Env env, Napi::Object exports) {
+    exports.Set("scaleVideo", Napi::Function::New(env, ScaleVideo));
+}
+
+} // namespace NdiScale
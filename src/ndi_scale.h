@@ -0,0 +1,74 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Scale - Downscaling of video frames for proxy and thumbnail streams
+ */
+
+#ifndef NDI_SCALE_H
+#define NDI_SCALE_H
+
+#include <napi.h>
+#include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include "ndi_utils.h"
+
+namespace NdiScale {
+
+enum Filter {
+    FilterBox,
+    FilterBilinear,
+    FilterLanczos
+};
+
+struct ScaleOptions {
+    // Output size; given only one, the other follows the frame's aspect ratio
+    int width = 0;
+    int height = 0;
+    
+    // Fraction of the frame's size when neither width nor height is set
+    double scale = 0;
+    
+    Filter filter = FilterBox;
+    
+    bool Enabled() const { return width > 0 || height > 0 || scale > 0; }
+};
+
+// Read { width?, height?, scale?, filter? } into options. Returns false with
+// a JavaScript exception pending if a field is out of range.
+bool ParseScaleOptions(Napi::Env env, const Napi::Object& object, ScaleOptions& options);
+
+// True if frames of this FourCC scale: UYVY/UYVA, BGRA/BGRX/RGBA/RGBX,
+// I420/YV12/NV12 and P216/PA16, each plane resampled in its own format
+bool CanScale(NDIlib_FourCC_video_type_e fourCC);
+
+// Resample a frame into a pooled block owned by payload. scaled is a copy of
+// frame's header describing the new data, tightly packed. Returns false,
+// leaving both untouched, if the frame's format or size does not scale.
+bool ScaleVideoFrame(
+    const NDIlib_video_frame_v2_t& frame,
+    const ScaleOptions& options,
+    NDIlib_video_frame_v2_t& scaled,
+    NdiUtils::FramePayload& payload
+);
+
+// Register scaleVideo on the module exports
+void Init(Napi::Env env, Napi::Object exports);
+
+} // namespace NdiScale
+
+#endif // NDI_SCALE_H
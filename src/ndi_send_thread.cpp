@@ -0,0 +1,259 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * NDI Send Thread - Implementation
+ */
+
+#include "ndi_send_thread.h"
+#include <chrono>
+#include <cstring>
+
+/**
+ * Time one frame stays on screen at the frame's rate, 30000/1001 when the
+ * frame does not say.
+ */
+static std::chrono::steady_clock::duration FrameDuration(const NDIlib_video_frame_v2_t& frame) {
+    int64_t rateN = frame.frame_rate_N > 0 ? frame.frame_rate_N : 30000;
+    int64_t rateD = frame.frame_rate_D > 0 ? frame.frame_rate_D : 1001;
+    
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::nanoseconds(1000000000LL * rateD / rateN)
+    );
+}
+
+template <typename Frame>
+NdiSendThread::QueuedFrame<Frame>::QueuedFrame(
+    const Frame& source,
+    const NdiFramePool::FrameKey& key,
+    size_t size
+) : frame(source),
+    key(key),
+    block(NdiFramePool::Acquire(key, size)),
+    size(size)
+{
+    memcpy(block, source.p_data, size);
+    frame.p_data = reinterpret_cast<decltype(frame.p_data)>(block);
+    
+    // The metadata string may belong to a JavaScript-owned format
+    if (source.p_metadata) {
+        metadata = source.p_metadata;
+        frame.p_metadata = metadata.c_str();
+    }
+}
+
+template <typename Frame>
+NdiSendThread::QueuedFrame<Frame>::~QueuedFrame() {
+    NdiFramePool::Release(key, block, size);
+}
+
+NdiSendThread::NdiSendThread(NDIlib_send_instance_t sender, const Options& options)
+    : m_sender(sender),
+      m_senderClocked(options.senderClocked),
+      m_video(options.videoDepth),
+      m_audio(options.audioDepth),
+      m_videoEnqueued(0),
+      m_videoSent(0),
+      m_videoRepeated(0),
+      m_videoOverruns(0),
+      m_audioEnqueued(0),
+      m_audioSent(0),
+      m_audioOverruns(0),
+      m_lateTicks(0),
+      m_stopping(false)
+{
+    m_thread = std::thread(&NdiSendThread::Run, this);
+}
+
+NdiSendThread::~NdiSendThread() {
+    Stop();
+}
+
+bool NdiSendThread::EnqueueVideo(const NDIlib_video_frame_v2_t& frame, size_t dataSize) {
+    // Checked before copying so a full queue costs no frame copy
+    if (m_video.Size() >= m_video.Capacity()) {
+        m_videoOverruns++;
+        return false;
+    }
+    
+    NdiFramePool::FrameKey key = {
+        frame.xres,
+        frame.yres,
+        frame.line_stride_in_bytes,
+        static_cast<uint32_t>(frame.FourCC)
+    };
+    
+    QueuedVideoPtr queued(new QueuedFrame<NDIlib_video_frame_v2_t>(frame, key, dataSize));
+    
+    if (!m_video.TryPush(queued)) {
+        m_videoOverruns++;
+        return false;
+    }
+    
+    m_videoEnqueued++;
+    Wake();
+    return true;
+}
+
+bool NdiSendThread::EnqueueAudio(const NDIlib_audio_frame_v2_t& frame, size_t dataSize) {
+    if (m_audio.Size() >= m_audio.Capacity()) {
+        m_audioOverruns++;
+        return false;
+    }
+    
+    NdiFramePool::FrameKey key = {
+        frame.no_samples,
+        frame.no_channels,
+        frame.channel_stride_in_bytes,
+        static_cast<uint32_t>(NDIlib_FourCC_audio_type_FLTP)
+    };
+    
+    QueuedAudioPtr queued(new QueuedFrame<NDIlib_audio_frame_v2_t>(frame, key, dataSize));
+    
+    if (!m_audio.TryPush(queued)) {
+        m_audioOverruns++;
+        return false;
+    }
+    
+    m_audioEnqueued++;
+    Wake();
+    return true;
+}
+
+void NdiSendThread::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopping) {
+            return;
+        }
+        m_stopping = true;
+    }
+    m_cv.notify_all();
+    
+    // Waits out at most one send, which NDI bounds by its own clocking
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    
+    QueuedVideoPtr video;
+    while (m_video.TryPop(video)) {}
+    QueuedAudioPtr audio;
+    while (m_audio.TryPop(audio)) {}
+}
+
+bool NdiSendThread::IsRunning() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_stopping;
+}
+
+NdiSendThread::Stats NdiSendThread::GetStats() {
+    Stats stats;
+    stats.videoEnqueued = m_videoEnqueued.load();
+    stats.videoSent = m_videoSent.load();
+    stats.videoRepeated = m_videoRepeated.load();
+    stats.videoOverruns = m_videoOverruns.load();
+    stats.audioEnqueued = m_audioEnqueued.load();
+    stats.audioSent = m_audioSent.load();
+    stats.audioOverruns = m_audioOverruns.load();
+    stats.lateTicks = m_lateTicks.load();
+    stats.videoDepth = m_video.Size();
+    stats.audioDepth = m_audio.Size();
+    return stats;
+}
+
+void NdiSendThread::Wake() {
+    // Taking the lock first means the thread cannot miss the wakeup between
+    // checking the rings and starting to wait
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+    }
+    m_cv.notify_one();
+}
+
+void NdiSendThread::Run() {
+    // The frame on air, kept so it can be repeated when JavaScript falls behind
+    QueuedVideoPtr current;
+    std::chrono::steady_clock::time_point next;
+    
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            if (current && m_senderClocked) {
+                // NDI's clock paces the previous send, nothing to wait for
+            } else if (current) {
+                m_cv.wait_until(lock, next, [this]() { return m_stopping; });
+            } else {
+                // Nothing to repeat yet, so the clock starts with the first frame
+                m_cv.wait(lock, [this]() {
+                    return m_stopping || m_video.Size() > 0 || m_audio.Size() > 0;
+                });
+            }
+            
+            if (m_stopping) {
+                break;
+            }
+        }
+        
+        bool started = static_cast<bool>(current);
+        QueuedVideoPtr queued;
+        bool fresh = m_video.TryPop(queued);
+        
+        if (fresh) {
+            // Hands the previous frame's block back to the pool
+            current = std::move(queued);
+        } else if (current) {
+            // Underrun: the repeat gets a timecode of its own
+            current->frame.timecode = NDIlib_send_timecode_synthesize;
+            m_videoRepeated++;
+        } else {
+            SendQueuedAudio();
+            continue;
+        }
+        
+        if (!started) {
+            next = std::chrono::steady_clock::now();
+        }
+        
+        NDIlib_send_send_video_v2(m_sender, &current->frame);
+        m_videoSent++;
+        
+        SendQueuedAudio();
+        
+        if (m_senderClocked) {
+            continue;
+        }
+        
+        // Ticks missed while a send ran long are skipped, not sent in a burst
+        next += FrameDuration(current->frame);
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        while (next <= now) {
+            next += FrameDuration(current->frame);
+            m_lateTicks++;
+        }
+    }
+}
+
+void NdiSendThread::SendQueuedAudio() {
+    QueuedAudioPtr queued;
+    while (m_audio.TryPop(queued)) {
+        NDIlib_send_send_audio_v2(m_sender, &queued->frame);
+        m_audioSent++;
+    }
+}
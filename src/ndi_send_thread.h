@@ -0,0 +1,127 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * NDI Send Thread - Dedicated, self-clocked send loop fed from JavaScript
+ */
+
+#ifndef NDI_SEND_THREAD_H
+#define NDI_SEND_THREAD_H
+
+#include <napi.h>
+#include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include "ndi_frame_pool.h"
+#include "ndi_ring_buffer.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * Sends queued frames from its own thread at the frame rate of the video,
+ * so pacing no longer depends on when the event loop gets round to calling
+ * sendVideo. JavaScript copies each frame into a pooled block and pushes it
+ * into a bounded lock-free ring; a full ring counts as an overrun and the
+ * frame is dropped. When no new frame is ready at a tick the previous one is
+ * sent again. Audio queued in between goes out right after each video frame.
+ */
+class NdiSendThread {
+public:
+    struct Options {
+        size_t videoDepth = 3;
+        size_t audioDepth = 16;
+        
+        // The sender clocks video itself, so each send already blocks for a
+        // frame period and the thread sends back to back instead of keeping
+        // a second clock that would drift against NDI's
+        bool senderClocked = false;
+    };
+    
+    struct Stats {
+        uint64_t videoEnqueued;
+        uint64_t videoSent;
+        uint64_t videoRepeated;
+        uint64_t videoOverruns;
+        uint64_t audioEnqueued;
+        uint64_t audioSent;
+        uint64_t audioOverruns;
+        uint64_t lateTicks;
+        size_t videoDepth;
+        size_t audioDepth;
+    };
+    
+    NdiSendThread(NDIlib_send_instance_t sender, const Options& options);
+    ~NdiSendThread();
+    
+    // Copy the frame's data and queue it, returns false on overrun
+    bool EnqueueVideo(const NDIlib_video_frame_v2_t& frame, size_t dataSize);
+    bool EnqueueAudio(const NDIlib_audio_frame_v2_t& frame, size_t dataSize);
+    
+    // Stop sending, join the thread and drop frames still queued
+    void Stop();
+    bool IsRunning();
+    
+    Stats GetStats();
+
+private:
+    // A frame whose data lives in a pooled block owned by this entry
+    template <typename Frame>
+    struct QueuedFrame {
+        Frame frame;
+        NdiFramePool::FrameKey key;
+        uint8_t* block;
+        size_t size;
+        std::string metadata;
+        
+        QueuedFrame(const Frame& source, const NdiFramePool::FrameKey& key, size_t size);
+        ~QueuedFrame();
+    };
+    
+    typedef std::unique_ptr<QueuedFrame<NDIlib_video_frame_v2_t>> QueuedVideoPtr;
+    typedef std::unique_ptr<QueuedFrame<NDIlib_audio_frame_v2_t>> QueuedAudioPtr;
+    
+    void Run();
+    void SendQueuedAudio();
+    void Wake();
+    
+    NDIlib_send_instance_t m_sender;
+    bool m_senderClocked;
+    NdiRingBuffer<QueuedVideoPtr> m_video;
+    NdiRingBuffer<QueuedAudioPtr> m_audio;
+    
+    std::atomic<uint64_t> m_videoEnqueued;
+    std::atomic<uint64_t> m_videoSent;
+    std::atomic<uint64_t> m_videoRepeated;
+    std::atomic<uint64_t> m_videoOverruns;
+    std::atomic<uint64_t> m_audioEnqueued;
+    std::atomic<uint64_t> m_audioSent;
+    std::atomic<uint64_t> m_audioOverruns;
+    std::atomic<uint64_t> m_lateTicks;
+    
+    // Only guards stopping and the wait for the first frame
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stopping;
+    std::thread m_thread;
+};
+
+#endif // NDI_SEND_THREAD_H
@@ -0,0 +1,101 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * NDI Send Watcher - Implementation
+ */
+
+#include "ndi_send_watcher.h"
+#include "ndi_utils.h"
+
+NdiSendWatcher::NdiSendWatcher(
+    Napi::Env env,
+    Napi::Function callback,
+    NDIlib_send_instance_t sender,
+    uint32_t timeout
+) : m_sender(sender),
+    m_timeout(timeout),
+    m_stopping(false)
+{
+    m_tsfn = Napi::ThreadSafeFunction::New(env, callback, "NdiSendWatcher", 0, 1);
+    m_thread = std::thread(&NdiSendWatcher::Run, this);
+}
+
+NdiSendWatcher::~NdiSendWatcher() {
+    Stop();
+}
+
+void NdiSendWatcher::Stop() {
+    if (m_stopping.exchange(true)) {
+        return;
+    }
+    
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    
+    m_tsfn.Release();
+}
+
+void NdiSendWatcher::Run() {
+    // The state at start is the baseline, only later changes are reported
+    NDIlib_tally_t last = {};
+    NDIlib_send_get_tally(m_sender, &last, 0);
+    int lastConnections = NDIlib_send_get_no_connections(m_sender, 0);
+    
+    while (!m_stopping.load()) {
+        // The tally is only filled in when NDI reports a change, a timeout
+        // leaves it as it was and just gives the connection count a look
+        NDIlib_tally_t tally = last;
+        bool tallyReported = NDIlib_send_get_tally(m_sender, &tally, m_timeout);
+        
+        if (m_stopping.load()) {
+            break;
+        }
+        
+        int connections = NDIlib_send_get_no_connections(m_sender, 0);
+        
+        Change* change = new Change();
+        change->tally = tally;
+        change->connections = connections;
+        change->tallyChanged = tallyReported &&
+            (tally.on_program != last.on_program || tally.on_preview != last.on_preview);
+        change->connectionsChanged = connections != lastConnections;
+        
+        if (!change->tallyChanged && !change->connectionsChanged) {
+            delete change;
+            continue;
+        }
+        
+        last = tally;
+        lastConnections = connections;
+        
+        napi_status status = m_tsfn.NonBlockingCall(change, [](Napi::Env env, Napi::Function callback, Change* change) {
+            Napi::Object result = Napi::Object::New(env);
+            result.Set("tally", change->tallyChanged ? NdiUtils::TallyToObject(env, change->tally) : env.Null());
+            result.Set("connections", change->connectionsChanged ? Napi::Number::New(env, change->connections) : env.Null());
+            delete change;
+            callback.Call({ result });
+        });
+        
+        if (status != napi_ok) {
+            delete change;
+        }
+    }
+}
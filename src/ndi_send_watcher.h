@@ -0,0 +1,69 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * NDI Send Watcher - Native thread reporting tally and connection changes
+ */
+
+#ifndef NDI_SEND_WATCHER_H
+#define NDI_SEND_WATCHER_H
+
+#include <napi.h>
+#include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include <atomic>
+#include <thread>
+
+/**
+ * Waits inside NDIlib_send_get_tally on its own thread and calls back into
+ * JavaScript only when the tally or the number of connected receivers
+ * changes. Tally changes arrive as soon as NDI reports them; the connection
+ * count is sampled each time the tally wait times out.
+ */
+class NdiSendWatcher {
+public:
+    NdiSendWatcher(
+        Napi::Env env,
+        Napi::Function callback,
+        NDIlib_send_instance_t sender,
+        uint32_t timeout
+    );
+    
+    ~NdiSendWatcher();
+    
+    // Stop watching and join the thread, waits out at most one timeout
+    void Stop();
+
+private:
+    struct Change {
+        NDIlib_tally_t tally;
+        int connections;
+        bool tallyChanged;
+        bool connectionsChanged;
+    };
+    
+    void Run();
+    
+    NDIlib_send_instance_t m_sender;
+    uint32_t m_timeout;
+    Napi::ThreadSafeFunction m_tsfn;
+    std::atomic<bool> m_stopping;
+    std::thread m_thread;
+};
+
+#endif // NDI_SEND_WATCHER_H
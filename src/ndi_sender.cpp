@@ -23,41 +23,61 @@
 #include "ndi_sender.h"
 #include "ndi_utils.h"
 #include "ndi_async.h"
+#include "ndi_convert.h"
+#include "ndi_video_format.h"
+#include "ndi_frame_pool.h"
+#include <algorithm>
 #include <cstring>
 
 Napi::FunctionReference NdiSender::constructor;
 
 Napi::Object NdiSender::Init(Napi::Env env, Napi::Object exports) {
     Napi::HandleScope scope(env);
-
+    
     Napi::Function func = DefineClass(env, "NdiSender", {
+        InstanceMethod("createVideoFormat", &NdiSender::CreateVideoFormat),
+        InstanceMethod("allocateVideoFrame", &NdiSender::AllocateVideoFrame),
         InstanceMethod("sendVideo", &NdiSender::SendVideo),
         InstanceMethod("sendVideoAsync", &NdiSender::SendVideoAsync),
         InstanceMethod("sendVideoPromise", &NdiSender::SendVideoPromise),
         InstanceMethod("sendAudio", &NdiSender::SendAudio),
         InstanceMethod("sendAudioPromise", &NdiSender::SendAudioPromise),
+        InstanceMethod("sendAudioInterleaved", &NdiSender::SendAudioInterleaved),
+        InstanceMethod("startAudioFifo", &NdiSender::StartAudioFifo),
+        InstanceMethod("pushAudio", &NdiSender::PushAudio),
+        InstanceMethod("flushAudio", &NdiSender::FlushAudio),
+        InstanceMethod("stopAudioFifo", &NdiSender::StopAudioFifo),
+        InstanceMethod("startSendThread", &NdiSender::StartSendThread),
+        InstanceMethod("stopSendThread", &NdiSender::StopSendThread),
+        InstanceMethod("enqueueVideo", &NdiSender::EnqueueVideo),
+        InstanceMethod("enqueueAudio", &NdiSender::EnqueueAudio),
+        InstanceMethod("getSendStats", &NdiSender::GetSendStats),
         InstanceMethod("sendMetadata", &NdiSender::SendMetadata),
         InstanceMethod("getTally", &NdiSender::GetTally),
         InstanceMethod("getTallyAsync", &NdiSender::GetTallyAsync),
         InstanceMethod("setTally", &NdiSender::SetTally),
         InstanceMethod("getConnections", &NdiSender::GetConnections),
         InstanceMethod("getConnectionsAsync", &NdiSender::GetConnectionsAsync),
+        InstanceMethod("startWatcher", &NdiSender::StartWatcher),
+        InstanceMethod("stopWatcher", &NdiSender::StopWatcher),
         InstanceMethod("getSourceName", &NdiSender::GetSourceName),
         InstanceMethod("clearConnectionMetadata", &NdiSender::ClearConnectionMetadata),
         InstanceMethod("addConnectionMetadata", &NdiSender::AddConnectionMetadata),
         InstanceMethod("destroy", &NdiSender::Destroy),
-        InstanceMethod("isValid", &NdiSender::IsValid)
+        InstanceMethod("isValid", &NdiSender::IsValid),
+        StaticMethod("sendVideoMulti", &NdiSender::SendVideoMulti)
     });
-
+    
     constructor = Napi::Persistent(func);
     constructor.SuppressDestruct();
-
+    
     exports.Set("NdiSender", func);
     return exports;
 }
 
 NdiSender::NdiSender(const Napi::CallbackInfo& info) 
-    : Napi::ObjectWrap<NdiSender>(info), m_sender(nullptr), m_destroyed(false), m_asyncVideoBuffer(nullptr) {
+    : Napi::ObjectWrap<NdiSender>(info), m_sender(nullptr), m_destroyed(false), m_zeroCopy(false),
+      m_clockVideo(true), m_asyncVideoInFlight(false), m_asyncVideoNext(0), m_asyncVideoRecycle(false), m_asyncMetadataNext(0) {
     
     Napi::Env env = info.Env();
     
@@ -96,24 +116,170 @@ NdiSender::NdiSender(const Napi::CallbackInfo& info)
         send_create.clock_audio = options.Get("clockAudio").As<Napi::Boolean>().Value();
     }
     
+    if (options.Has("zeroCopy") && options.Get("zeroCopy").IsBoolean()) {
+        m_zeroCopy = options.Get("zeroCopy").As<Napi::Boolean>().Value();
+    }
+    
+    m_clockVideo = send_create.clock_video;
     m_sender = NDIlib_send_create(&send_create);
     
     if (!m_sender) {
         Napi::Error::New(env, "Failed to create NDI sender instance").ThrowAsJavaScriptException();
         return;
     }
+    
+    m_handle = SendHandle(m_sender, NDIlib_send_destroy);
 }
 
 NdiSender::~NdiSender() {
-    if (m_asyncVideoBuffer) {
-        delete[] m_asyncVideoBuffer;
-        m_asyncVideoBuffer = nullptr;
+    if (m_watcher) {
+        m_watcher->Stop();
+    }
+    
+    if (m_sendThread) {
+        m_sendThread->Stop();
+    }
+    
+    FlushAsyncVideo();
+    
+    m_handle.reset();
+    m_sender = nullptr;
+}
+
+Napi::Value NdiSender::CreateVideoFormat(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected video format options object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    return NdiVideoFormat::NewInstance(env, info[0]);
+}
+
+Napi::Value NdiSender::AllocateVideoFrame(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsNumber() || !info[1].IsNumber()) {
+        Napi::TypeError::New(env, "Expected xres and yres").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    NDIlib_video_frame_v2_t frame = {};
+    frame.xres = info[0].As<Napi::Number>().Int32Value();
+    frame.yres = info[1].As<Napi::Number>().Int32Value();
+    frame.FourCC = NDIlib_FourCC_video_type_BGRA;
+    
+    if (info.Length() > 2 && info[2].IsString()) {
+        frame.FourCC = NdiUtils::StringToFourCC(info[2].As<Napi::String>().Utf8Value());
+    }
+    
+    if (frame.xres <= 0 || frame.yres <= 0) {
+        Napi::TypeError::New(env, "Video frame needs positive xres and yres").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    // Tightly packed, matching the stride sendVideo assumes when none is given
+    frame.line_stride_in_bytes = NdiUtils::DefaultLineStride(frame.FourCC, frame.xres);
+    
+    NdiFramePool::FrameKey key = {
+        frame.xres,
+        frame.yres,
+        frame.line_stride_in_bytes,
+        static_cast<uint32_t>(frame.FourCC)
+    };
+    
+    return NdiFramePool::AllocateSendBuffer(env, key, NdiUtils::VideoFrameDataSize(frame));
+}
+
+bool NdiSender::VideoFrameFromFormat(
+    const Napi::CallbackInfo& info,
+    bool copy,
+    NDIlib_video_frame_v2_t& frame,
+    uint8_t** dataBuffer
+) {
+    Napi::Env env = info.Env();
+    NdiVideoFormat* format = NdiVideoFormat::FromValue(info[0]);
+    
+    if (!format->BindFrame(env, info.Length() > 1 ? info[1] : env.Undefined(),
+                           info.Length() > 2 ? info[2] : env.Undefined(), frame)) {
+        return false;
+    }
+    
+    // Sends that complete after this call returns need their own copy
+    if (copy) {
+        *dataBuffer = new uint8_t[format->DataSize()];
+        memcpy(*dataBuffer, frame.p_data, format->DataSize());
+        frame.p_data = *dataBuffer;
     }
     
+    return true;
+}
+
+Napi::Value NdiSender::FrameDataValue(const Napi::CallbackInfo& info) {
+    if (NdiVideoFormat::FromValue(info[0])) {
+        return info.Length() > 1 ? info[1] : info.Env().Undefined();
+    }
+    
+    Napi::Object frameObj = info[0].As<Napi::Object>();
+    return frameObj.Has("data") ? frameObj.Get("data") : info.Env().Undefined();
+}
+
+bool NdiSender::UnpackV210(Napi::Env env, NDIlib_video_frame_v2_t& frame, Napi::Value& data) {
+    if (!frame.p_data) {
+        Napi::TypeError::New(env, "Expected video data Buffer").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    NDIlib_video_frame_v2_t p216 = frame;
+    p216.FourCC = NDIlib_FourCC_video_type_P216;
+    p216.line_stride_in_bytes = NdiUtils::DefaultLineStride(p216.FourCC, frame.xres);
+    
+    if (frame.xres <= 0 || (frame.xres & 1) != 0 || frame.yres <= 0 ||
+        frame.line_stride_in_bytes < NdiUtils::DefaultLineStride(frame.FourCC, frame.xres)) {
+        Napi::RangeError::New(env, "V210 frames need a positive even xres, a positive yres and lines padded to 128 bytes")
+            .ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    NdiFramePool::FrameKey key = {
+        p216.xres,
+        p216.yres,
+        p216.line_stride_in_bytes,
+        static_cast<uint32_t>(p216.FourCC)
+    };
+    Napi::Buffer<uint8_t> buffer = NdiFramePool::AllocateSendBuffer(env, key, NdiUtils::VideoFrameDataSize(p216));
+    
+    if (!NdiConvert::Convert(frame.FourCC, frame.p_data, frame.line_stride_in_bytes, p216.FourCC,
+                             buffer.Data(), p216.line_stride_in_bytes, p216.xres, p216.yres)) {
+        NdiUtils::ReleaseBuffer(env, buffer);
+        Napi::RangeError::New(env, "V210 line stride must be a multiple of 16").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    p216.p_data = buffer.Data();
+    frame = p216;
+    data = buffer;
+    return true;
+}
+
+void NdiSender::FlushAsyncVideo() {
+    if (!m_asyncVideoInFlight) {
+        return;
+    }
+    
+    // Sending nullptr waits for the previous async send to complete
     if (m_sender && !m_destroyed) {
-        NDIlib_send_destroy(m_sender);
-        m_sender = nullptr;
+        NDIlib_send_send_video_async_v2(m_sender, nullptr);
     }
+    
+    m_asyncVideoInFlight = false;
+    
+    if (m_asyncVideoRecycle) {
+        NdiFramePool::EndSend(Env(), m_asyncVideoPinned.Value());
+        m_asyncVideoRecycle = false;
+    }
+    m_asyncVideoPinned.Reset();
 }
 
 Napi::Value NdiSender::SendVideo(const Napi::CallbackInfo& info) {
@@ -129,14 +295,32 @@ Napi::Value NdiSender::SendVideo(const Napi::CallbackInfo& info) {
         return env.Null();
     }
     
-    Napi::Object frameObj = info[0].As<Napi::Object>();
-    uint8_t* dataBuffer = nullptr;
-    NDIlib_video_frame_v2_t frame = NdiUtils::ObjectToVideoFrame(env, frameObj, &dataBuffer);
+    // NDI is done with the data when a synchronous send returns, so it is
+    // always sent straight from the caller's Buffer
+    NDIlib_video_frame_v2_t frame;
+    
+    if (NdiVideoFormat::FromValue(info[0])) {
+        if (!VideoFrameFromFormat(info, false, frame, nullptr)) {
+            return env.Null();
+        }
+    } else {
+        frame = NdiUtils::ObjectToVideoFrame(env, info[0].As<Napi::Object>(), nullptr);
+        if (env.IsExceptionPending()) {
+            return env.Null();
+        }
+    }
+    
+    Napi::Value data = FrameDataValue(info);
+    if (frame.FourCC == NdiUtils::FourCCVideoV210 && !UnpackV210(env, frame, data)) {
+        return env.Null();
+    }
+    
+    bool allocated = NdiFramePool::BeginSend(data);
     
     NDIlib_send_send_video_v2(m_sender, &frame);
     
-    if (dataBuffer) {
-        delete[] dataBuffer;
+    if (allocated) {
+        NdiFramePool::EndSend(env, data);
     }
     
     return env.Undefined();
@@ -155,19 +339,60 @@ Napi::Value NdiSender::SendVideoAsync(const Napi::CallbackInfo& info) {
         return env.Null();
     }
     
-    // Clean up previous async buffer
-    if (m_asyncVideoBuffer) {
-        // Wait for previous async send to complete by sending nullptr
-        NDIlib_send_send_video_async_v2(m_sender, nullptr);
-        delete[] m_asyncVideoBuffer;
-        m_asyncVideoBuffer = nullptr;
+    NDIlib_video_frame_v2_t frame;
+    
+    if (NdiVideoFormat::FromValue(info[0])) {
+        if (!VideoFrameFromFormat(info, false, frame, nullptr)) {
+            return env.Null();
+        }
+    } else {
+        frame = NdiUtils::ObjectToVideoFrame(env, info[0].As<Napi::Object>(), nullptr);
+        if (env.IsExceptionPending()) {
+            return env.Null();
+        }
     }
     
-    Napi::Object frameObj = info[0].As<Napi::Object>();
-    NDIlib_video_frame_v2_t frame = NdiUtils::ObjectToVideoFrame(env, frameObj, &m_asyncVideoBuffer);
+    Napi::Value data = FrameDataValue(info);
+    if (frame.FourCC == NdiUtils::FourCCVideoV210 && !UnpackV210(env, frame, data)) {
+        return env.Null();
+    }
     
+    bool allocated = NdiFramePool::BeginSend(data);
+    Napi::ObjectReference pinned;
+    
+    if (m_zeroCopy || allocated) {
+        if (data.IsObject()) {
+            pinned = Napi::Persistent(data.As<Napi::Object>());
+        }
+    } else if (frame.p_data && data.IsTypedArray()) {
+        // The in-flight frame lives in the other slot, this one was released
+        // when that frame was queued
+        std::vector<uint8_t>& buffer = m_asyncVideoBuffers[m_asyncVideoNext];
+        size_t dataSize = data.As<Napi::TypedArray>().ByteLength();
+        buffer.resize(dataSize);
+        memcpy(buffer.data(), frame.p_data, dataSize);
+        frame.p_data = buffer.data();
+        m_asyncVideoNext = (m_asyncVideoNext + 1) % kAsyncVideoBufferCount;
+    }
+    
+    if (frame.p_metadata) {
+        std::string& metadata = m_asyncVideoMetadata[m_asyncMetadataNext];
+        metadata = frame.p_metadata;
+        frame.p_metadata = metadata.c_str();
+        m_asyncMetadataNext = (m_asyncMetadataNext + 1) % kAsyncVideoBufferCount;
+    }
+    
+    // Returns once NDI is done with the previous frame, but not this one
     NDIlib_send_send_video_async_v2(m_sender, &frame);
     
+    if (m_asyncVideoRecycle) {
+        NdiFramePool::EndSend(env, m_asyncVideoPinned.Value());
+    }
+    
+    m_asyncVideoInFlight = true;
+    m_asyncVideoPinned = std::move(pinned);
+    m_asyncVideoRecycle = allocated;
+    
     return env.Undefined();
 }
 
@@ -185,18 +410,396 @@ Napi::Value NdiSender::SendAudio(const Napi::CallbackInfo& info) {
     }
     
     Napi::Object frameObj = info[0].As<Napi::Object>();
-    float* dataBuffer = nullptr;
-    NDIlib_audio_frame_v2_t frame = NdiUtils::ObjectToAudioFrame(env, frameObj, &dataBuffer);
+    NDIlib_audio_frame_v2_t frame = NdiUtils::ObjectToAudioFrame(env, frameObj, nullptr);
     
     NDIlib_send_send_audio_v2(m_sender, &frame);
     
-    if (dataBuffer) {
-        delete[] dataBuffer;
+    return env.Undefined();
+}
+
+Napi::Value NdiSender::SendAudioInterleaved(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_sender || m_destroyed) {
+        Napi::Error::New(env, "Sender has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (info.Length() < 1 || !info[0].IsTypedArray()) {
+        Napi::TypeError::New(env, "Expected interleaved audio Buffer or typed array").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::TypedArray samples = info[0].As<Napi::TypedArray>();
+    Napi::Object options = info.Length() > 1 && info[1].IsObject() ? info[1].As<Napi::Object>() : Napi::Object::New(env);
+    
+    // The sample format follows the array type unless given explicitly
+    std::string format;
+    if (options.Has("format") && options.Get("format").IsString()) {
+        format = options.Get("format").As<Napi::String>().Utf8Value();
+    } else if (samples.TypedArrayType() == napi_int16_array) {
+        format = "16s";
+    } else if (samples.TypedArrayType() == napi_int32_array) {
+        format = "32s";
+    } else if (samples.TypedArrayType() == napi_float32_array) {
+        format = "32f";
+    } else {
+        Napi::TypeError::New(env, "format is required for a Buffer of audio samples").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (format != "16s" && format != "32s" && format != "32f") {
+        Napi::TypeError::New(env, "format must be '16s', '32s' or '32f'").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    size_t sampleSize = format == "16s" ? sizeof(int16_t) : sizeof(int32_t);
+    
+    int sampleRate = 48000;
+    if (options.Has("sampleRate") && options.Get("sampleRate").IsNumber()) {
+        sampleRate = options.Get("sampleRate").As<Napi::Number>().Int32Value();
+    }
+    
+    int channels = 2;
+    if (options.Has("channels") && options.Get("channels").IsNumber()) {
+        channels = options.Get("channels").As<Napi::Number>().Int32Value();
+    }
+    
+    if (channels <= 0) {
+        Napi::TypeError::New(env, "channels must be positive").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t timecode = NDIlib_send_timecode_synthesize;
+    if (options.Has("timecode") && options.Get("timecode").IsNumber()) {
+        timecode = static_cast<int64_t>(options.Get("timecode").As<Napi::Number>().DoubleValue());
+    }
+    
+    int referenceLevel = 0;
+    if (options.Has("referenceLevel") && options.Get("referenceLevel").IsNumber()) {
+        referenceLevel = options.Get("referenceLevel").As<Napi::Number>().Int32Value();
+    }
+    
+    size_t frameSize = sampleSize * channels;
+    if (samples.ByteLength() % frameSize != 0) {
+        Napi::RangeError::New(env, "Audio data is not a whole number of samples for every channel")
+            .ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    // NDI converts to planar float while sending, straight from the caller's memory
+    void* data = static_cast<uint8_t*>(samples.ArrayBuffer().Data()) + samples.ByteOffset();
+    int noSamples = static_cast<int>(samples.ByteLength() / frameSize);
+    
+    if (format == "16s") {
+        NDIlib_audio_frame_interleaved_16s_t frame = {};
+        frame.sample_rate = sampleRate;
+        frame.no_channels = channels;
+        frame.no_samples = noSamples;
+        frame.timecode = timecode;
+        frame.reference_level = referenceLevel;
+        frame.p_data = static_cast<int16_t*>(data);
+        NDIlib_util_send_send_audio_interleaved_16s(m_sender, &frame);
+    } else if (format == "32s") {
+        NDIlib_audio_frame_interleaved_32s_t frame = {};
+        frame.sample_rate = sampleRate;
+        frame.no_channels = channels;
+        frame.no_samples = noSamples;
+        frame.timecode = timecode;
+        frame.reference_level = referenceLevel;
+        frame.p_data = static_cast<int32_t*>(data);
+        NDIlib_util_send_send_audio_interleaved_32s(m_sender, &frame);
+    } else {
+        NDIlib_audio_frame_interleaved_32f_t frame = {};
+        frame.sample_rate = sampleRate;
+        frame.no_channels = channels;
+        frame.no_samples = noSamples;
+        frame.timecode = timecode;
+        frame.p_data = static_cast<float*>(data);
+        NDIlib_util_send_send_audio_interleaved_32f(m_sender, &frame);
+    }
+    
+    return env.Undefined();
+}
+
+void NdiSender::SendFifoAudio(const NDIlib_audio_frame_v2_t& frame) {
+    if (m_sendThread && m_sendThread->IsRunning()) {
+        size_t dataSize = static_cast<size_t>(frame.no_channels) * frame.channel_stride_in_bytes;
+        m_sendThread->EnqueueAudio(frame, dataSize);
+    } else {
+        NDIlib_send_send_audio_v2(m_sender, &frame);
+    }
+}
+
+Napi::Value NdiSender::StartAudioFifo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_sender || m_destroyed) {
+        Napi::Error::New(env, "Sender has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    NdiAudioFifo::Options fifoOptions;
+    
+    if (info.Length() > 0 && info[0].IsObject()) {
+        Napi::Object options = info[0].As<Napi::Object>();
+        
+        if (options.Has("sampleRate") && options.Get("sampleRate").IsNumber()) {
+            fifoOptions.sampleRate = options.Get("sampleRate").As<Napi::Number>().Int32Value();
+        }
+        if (options.Has("noChannels") && options.Get("noChannels").IsNumber()) {
+            fifoOptions.channels = options.Get("noChannels").As<Napi::Number>().Int32Value();
+        }
+        if (options.Has("frameRateN") && options.Get("frameRateN").IsNumber()) {
+            fifoOptions.frameRateN = options.Get("frameRateN").As<Napi::Number>().Int32Value();
+        }
+        if (options.Has("frameRateD") && options.Get("frameRateD").IsNumber()) {
+            fifoOptions.frameRateD = options.Get("frameRateD").As<Napi::Number>().Int32Value();
+        }
+        if (options.Has("samplesPerFrame") && options.Get("samplesPerFrame").IsNumber()) {
+            fifoOptions.samplesPerFrame = options.Get("samplesPerFrame").As<Napi::Number>().Int32Value();
+        }
+    }
+    
+    // Samples still pending in a previous FIFO are sent first
+    if (m_audioFifo) {
+        m_audioFifo->Flush([this](const NDIlib_audio_frame_v2_t& frame) { SendFifoAudio(frame); });
+    }
+    
+    m_audioFifo.reset(new NdiAudioFifo(fifoOptions));
+    
+    return env.Undefined();
+}
+
+Napi::Value NdiSender::PushAudio(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_sender || m_destroyed) {
+        Napi::Error::New(env, "Sender has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (!m_audioFifo) {
+        Napi::Error::New(env, "Audio FIFO is not started").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    NdiAudioFifo::EmitCallback emit = [this](const NDIlib_audio_frame_v2_t& frame) { SendFifoAudio(frame); };
+    int channels = m_audioFifo->Channels();
+    size_t emitted = 0;
+    
+    if (info.Length() > 0 && info[0].IsTypedArray() &&
+        info[0].As<Napi::TypedArray>().TypedArrayType() == napi_float32_array) {
+        // Interleaved samples
+        Napi::Float32Array samples = info[0].As<Napi::Float32Array>();
+        if (samples.ElementLength() % channels != 0) {
+            Napi::RangeError::New(env, "Audio data is not a whole number of samples for every channel")
+                .ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        emitted = m_audioFifo->PushInterleaved(samples.Data(), samples.ElementLength() / channels, emit);
+    } else if (info.Length() > 0 && info[0].IsArray()) {
+        // One Float32Array per channel, as WebAudio hands them out
+        Napi::Array planes = info[0].As<Napi::Array>();
+        
+        if (planes.Length() != static_cast<uint32_t>(channels)) {
+            Napi::TypeError::New(env, "Expected one Float32Array per channel").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        std::vector<const float*> pointers(channels);
+        size_t sampleCount = 0;
+        
+        for (int ch = 0; ch < channels; ch++) {
+            Napi::Value plane = planes.Get(static_cast<uint32_t>(ch));
+            if (!plane.IsTypedArray() || plane.As<Napi::TypedArray>().TypedArrayType() != napi_float32_array) {
+                Napi::TypeError::New(env, "Expected one Float32Array per channel").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+            
+            Napi::Float32Array samples = plane.As<Napi::Float32Array>();
+            if (ch > 0 && samples.ElementLength() != sampleCount) {
+                Napi::TypeError::New(env, "Channel arrays differ in length").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+            
+            pointers[ch] = samples.Data();
+            sampleCount = samples.ElementLength();
+        }
+        
+        emitted = m_audioFifo->PushPlanar(pointers.data(), sampleCount, emit);
+    } else {
+        Napi::TypeError::New(env, "Expected interleaved Float32Array or array of channel Float32Arrays").ThrowAsJavaScriptException();
+        return env.Null();
     }
     
+    return Napi::Number::New(env, static_cast<double>(emitted));
+}
+
+Napi::Value NdiSender::FlushAudio(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_audioFifo || !m_sender || m_destroyed) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    bool flushed = m_audioFifo->Flush([this](const NDIlib_audio_frame_v2_t& frame) { SendFifoAudio(frame); });
+    return Napi::Boolean::New(env, flushed);
+}
+
+Napi::Value NdiSender::StopAudioFifo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    // The last, partial frame still goes out
+    if (m_audioFifo && m_sender && !m_destroyed) {
+        m_audioFifo->Flush([this](const NDIlib_audio_frame_v2_t& frame) { SendFifoAudio(frame); });
+    }
+    m_audioFifo.reset();
+    
     return env.Undefined();
 }
 
+Napi::Value NdiSender::StartSendThread(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_sender || m_destroyed) {
+        Napi::Error::New(env, "Sender has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (m_sendThread) {
+        m_sendThread->Stop();
+    }
+    
+    NdiSendThread::Options threadOptions;
+    
+    if (info.Length() > 0 && info[0].IsObject()) {
+        Napi::Object options = info[0].As<Napi::Object>();
+        
+        if (options.Has("videoDepth") && options.Get("videoDepth").IsNumber()) {
+            threadOptions.videoDepth = options.Get("videoDepth").As<Napi::Number>().Uint32Value();
+        }
+        
+        if (options.Has("audioDepth") && options.Get("audioDepth").IsNumber()) {
+            threadOptions.audioDepth = options.Get("audioDepth").As<Napi::Number>().Uint32Value();
+        }
+    }
+    
+    threadOptions.senderClocked = m_clockVideo;
+    m_sendThread.reset(new NdiSendThread(m_sender, threadOptions));
+    
+    return env.Undefined();
+}
+
+Napi::Value NdiSender::StopSendThread(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    // Kept around so getSendStats() still reports the final counters
+    if (m_sendThread) {
+        m_sendThread->Stop();
+    }
+    
+    return env.Undefined();
+}
+
+Napi::Value NdiSender::EnqueueVideo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_sendThread || !m_sendThread->IsRunning()) {
+        Napi::Error::New(env, "Send thread is not running").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected video frame object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    NDIlib_video_frame_v2_t frame;
+    
+    if (NdiVideoFormat::FromValue(info[0])) {
+        if (!VideoFrameFromFormat(info, false, frame, nullptr)) {
+            return env.Null();
+        }
+    } else {
+        frame = NdiUtils::ObjectToVideoFrame(env, info[0].As<Napi::Object>(), nullptr);
+        if (env.IsExceptionPending()) {
+            return env.Null();
+        }
+    }
+    
+    Napi::Value data = FrameDataValue(info);
+    bool unpacked = frame.FourCC == NdiUtils::FourCCVideoV210;
+    if (unpacked && !UnpackV210(env, frame, data)) {
+        return env.Null();
+    }
+    
+    if (!frame.p_data || !data.IsTypedArray()) {
+        Napi::TypeError::New(env, "Expected video data Buffer").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    // The thread sends a copy, so the caller's Buffer is free again on return
+    size_t dataSize = data.As<Napi::TypedArray>().ByteLength();
+    bool queued = m_sendThread->EnqueueVideo(frame, dataSize);
+    
+    if (unpacked) {
+        NdiUtils::ReleaseBuffer(env, data);
+    }
+    
+    return Napi::Boolean::New(env, queued);
+}
+
+Napi::Value NdiSender::EnqueueAudio(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_sendThread || !m_sendThread->IsRunning()) {
+        Napi::Error::New(env, "Send thread is not running").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected audio frame object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object frameObj = info[0].As<Napi::Object>();
+    NDIlib_audio_frame_v2_t frame = NdiUtils::ObjectToAudioFrame(env, frameObj, nullptr);
+    
+    Napi::Value data = frameObj.Get("data");
+    if (!frame.p_data || !data.IsTypedArray()) {
+        Napi::TypeError::New(env, "Expected audio data Buffer").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    size_t dataSize = data.As<Napi::TypedArray>().ByteLength();
+    return Napi::Boolean::New(env, m_sendThread->EnqueueAudio(frame, dataSize));
+}
+
+Napi::Value NdiSender::GetSendStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_sendThread) {
+        return env.Null();
+    }
+    
+    NdiSendThread::Stats stats = m_sendThread->GetStats();
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("videoEnqueued", Napi::Number::New(env, static_cast<double>(stats.videoEnqueued)));
+    result.Set("videoSent", Napi::Number::New(env, static_cast<double>(stats.videoSent)));
+    result.Set("videoRepeated", Napi::Number::New(env, static_cast<double>(stats.videoRepeated)));
+    result.Set("videoOverruns", Napi::Number::New(env, static_cast<double>(stats.videoOverruns)));
+    result.Set("audioEnqueued", Napi::Number::New(env, static_cast<double>(stats.audioEnqueued)));
+    result.Set("audioSent", Napi::Number::New(env, static_cast<double>(stats.audioSent)));
+    result.Set("audioOverruns", Napi::Number::New(env, static_cast<double>(stats.audioOverruns)));
+    result.Set("lateTicks", Napi::Number::New(env, static_cast<double>(stats.lateTicks)));
+    result.Set("videoDepth", Napi::Number::New(env, static_cast<double>(stats.videoDepth)));
+    result.Set("audioDepth", Napi::Number::New(env, static_cast<double>(stats.audioDepth)));
+    return result;
+}
+
 Napi::Value NdiSender::SendMetadata(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
@@ -274,6 +877,47 @@ Napi::Value NdiSender::GetConnections(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, numConnections);
 }
 
+Napi::Value NdiSender::StartWatcher(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!m_sender || m_destroyed) {
+        Napi::Error::New(env, "Sender has been destroyed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (info.Length() < 1 || !info[0].IsFunction()) {
+        Napi::TypeError::New(env, "Expected change callback function").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (m_watcher) {
+        Napi::Error::New(env, "Watcher is already running").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    // Also the longest a connection count change waits to be noticed
+    uint32_t timeout = 100;
+    if (info.Length() > 1 && info[1].IsNumber()) {
+        timeout = info[1].As<Napi::Number>().Uint32Value();
+    }
+    
+    // A zero wait would turn the watcher thread into a busy loop
+    if (timeout == 0) {
+        Napi::RangeError::New(env, "Watcher interval must be at least 1 ms").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    m_watcher.reset(new NdiSendWatcher(env, info[0].As<Napi::Function>(), m_sender, timeout));
+    
+    return env.Undefined();
+}
+
+Napi::Value NdiSender::StopWatcher(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    m_watcher.reset();
+    return env.Undefined();
+}
+
 Napi::Value NdiSender::GetSourceName(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
@@ -333,17 +977,22 @@ Napi::Value NdiSender::AddConnectionMetadata(const Napi::CallbackInfo& info) {
 Napi::Value NdiSender::Destroy(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
-    if (m_asyncVideoBuffer) {
-        // Wait for async send to complete
-        if (m_sender) {
-            NDIlib_send_send_video_async_v2(m_sender, nullptr);
-        }
-        delete[] m_asyncVideoBuffer;
-        m_asyncVideoBuffer = nullptr;
+    // Both threads call into the sender, so they stop before it is destroyed
+    m_watcher.reset();
+    
+    if (m_sendThread) {
+        m_sendThread->Stop();
+    }
+    
+    FlushAsyncVideo();
+    
+    for (std::vector<uint8_t>& buffer : m_asyncVideoBuffers) {
+        std::vector<uint8_t>().swap(buffer);
     }
     
+    // The NDI instance itself goes away once in-flight sends have finished
     if (m_sender && !m_destroyed) {
-        NDIlib_send_destroy(m_sender);
+        m_handle.reset();
         m_sender = nullptr;
         m_destroyed = true;
     }
@@ -369,11 +1018,131 @@ Napi::Value NdiSender::SendVideoPromise(const Napi::CallbackInfo& info) {
         return env.Null();
     }
     
-    Napi::Object frameObj = info[0].As<Napi::Object>();
+    // With zeroCopy, or for a Buffer from allocateVideoFrame(), the worker
+    // pins the caller's Buffer instead of copying it
+    Napi::Value data = FrameDataValue(info);
+    bool allocated = NdiFramePool::BeginSend(data);
+    bool pin = m_zeroCopy || allocated;
+    NdiVideoFormat* format = NdiVideoFormat::FromValue(info[0]);
+    
+    // V210 is unpacked into a pooled P216 Buffer straight from the caller's
+    // memory below, so it is never copied first
+    bool v210 = false;
+    if (format) {
+        v210 = format->FourCC() == NdiUtils::FourCCVideoV210;
+    } else {
+        Napi::Value fourCC = info[0].As<Napi::Object>().Get("fourCC");
+        v210 = fourCC.IsString() &&
+               NdiUtils::StringToFourCC(fourCC.As<Napi::String>().Utf8Value()) == NdiUtils::FourCCVideoV210;
+    }
+    
+    bool copy = !pin && !v210;
     uint8_t* dataBuffer = nullptr;
-    NDIlib_video_frame_v2_t frame = NdiUtils::ObjectToVideoFrame(env, frameObj, &dataBuffer);
+    uint8_t** copyTo = copy ? &dataBuffer : nullptr;
+    NDIlib_video_frame_v2_t frame;
+    
+    if (format) {
+        if (!VideoFrameFromFormat(info, copy, frame, copyTo)) {
+            if (allocated) {
+                NdiFramePool::EndSend(env, data);
+            }
+            return env.Null();
+        }
+    } else {
+        frame = NdiUtils::ObjectToVideoFrame(env, info[0].As<Napi::Object>(), copyTo);
+        if (env.IsExceptionPending()) {
+            if (allocated) {
+                NdiFramePool::EndSend(env, data);
+            }
+            return env.Null();
+        }
+    }
+    
+    if (frame.FourCC == NdiUtils::FourCCVideoV210) {
+        // The unpacked P216 Buffer is pinned and recycled in place of the caller's
+        Napi::Value unpacked = data;
+        bool ok = UnpackV210(env, frame, unpacked);
+        
+        if (allocated) {
+            NdiFramePool::EndSend(env, data);
+        }
+        
+        if (!ok) {
+            return env.Null();
+        }
+        
+        data = unpacked;
+        allocated = NdiFramePool::BeginSend(data);
+        pin = true;
+    }
+    
+    Napi::Value pinned = pin ? data : Napi::Value();
+    SendVideoWorker* worker = new SendVideoWorker(env, m_handle, frame, dataBuffer, pinned, allocated);
+    Napi::Promise promise = worker->m_deferred.Promise();
+    worker->Queue();
+    
+    return promise;
+}
+
+Napi::Value NdiSender::SendVideoMulti(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsArray() || !info[1].IsObject()) {
+        Napi::TypeError::New(env, "Expected array of senders and a video frame").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Array list = info[0].As<Napi::Array>();
+    std::vector<SendHandle> senders;
+    senders.reserve(list.Length());
+    
+    for (uint32_t i = 0; i < list.Length(); i++) {
+        Napi::Value value = list.Get(i);
+        if (!value.IsObject() || !value.As<Napi::Object>().InstanceOf(constructor.Value())) {
+            Napi::TypeError::New(env, "Expected array of senders").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        NdiSender* sender = Napi::ObjectWrap<NdiSender>::Unwrap(value.As<Napi::Object>());
+        if (!sender->m_sender || sender->m_destroyed) {
+            Napi::Error::New(env, "Sender has been destroyed").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        // The sends run in parallel, and one NDI instance must not send twice at once
+        if (std::find(senders.begin(), senders.end(), sender->m_handle) != senders.end()) {
+            Napi::TypeError::New(env, "Each sender may only appear once").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        senders.push_back(sender->m_handle);
+    }
+    
+    // Arguments after the sender list are the same as for sendVideo()
+    NDIlib_video_frame_v2_t frame;
+    Napi::Value data;
+    
+    if (NdiVideoFormat* format = NdiVideoFormat::FromValue(info[1])) {
+        data = info.Length() > 2 ? info[2] : env.Undefined();
+        if (!format->BindFrame(env, data, info.Length() > 3 ? info[3] : env.Undefined(), frame)) {
+            return env.Null();
+        }
+    } else {
+        Napi::Object frameObj = info[1].As<Napi::Object>();
+        frame = NdiUtils::ObjectToVideoFrame(env, frameObj, nullptr);
+        if (env.IsExceptionPending()) {
+            return env.Null();
+        }
+        data = frameObj.Has("data") ? frameObj.Get("data") : env.Undefined();
+    }
+    
+    if (frame.FourCC == NdiUtils::FourCCVideoV210 && !UnpackV210(env, frame, data)) {
+        return env.Null();
+    }
     
-    SendVideoWorker* worker = new SendVideoWorker(env, m_sender, frame, dataBuffer);
+    // Parsed and pinned once, whatever the number of senders
+    bool allocated = NdiFramePool::BeginSend(data);
+    SendVideoMultiWorker* worker = new SendVideoMultiWorker(env, std::move(senders), frame, data, allocated);
     Napi::Promise promise = worker->m_deferred.Promise();
     worker->Queue();
     
@@ -395,9 +1164,10 @@ Napi::Value NdiSender::SendAudioPromise(const Napi::CallbackInfo& info) {
     
     Napi::Object frameObj = info[0].As<Napi::Object>();
     float* dataBuffer = nullptr;
-    NDIlib_audio_frame_v2_t frame = NdiUtils::ObjectToAudioFrame(env, frameObj, &dataBuffer);
+    NDIlib_audio_frame_v2_t frame = NdiUtils::ObjectToAudioFrame(env, frameObj, m_zeroCopy ? nullptr : &dataBuffer);
     
-    SendAudioWorker* worker = new SendAudioWorker(env, m_sender, frame, dataBuffer);
+    Napi::Value pinned = m_zeroCopy ? FrameDataValue(info) : Napi::Value();
+    SendAudioWorker* worker = new SendAudioWorker(env, m_handle, frame, dataBuffer, pinned);
     Napi::Promise promise = worker->m_deferred.Promise();
     worker->Queue();
     
@@ -417,7 +1187,7 @@ Napi::Value NdiSender::GetTallyAsync(const Napi::CallbackInfo& info) {
         timeout = info[0].As<Napi::Number>().Uint32Value();
     }
     
-    GetTallyWorker* worker = new GetTallyWorker(env, m_sender, timeout);
+    GetTallyWorker* worker = new GetTallyWorker(env, m_handle, timeout);
     Napi::Promise promise = worker->m_deferred.Promise();
     worker->Queue();
     
@@ -437,7 +1207,7 @@ Napi::Value NdiSender::GetConnectionsAsync(const Napi::CallbackInfo& info) {
         timeout = info[0].As<Napi::Number>().Uint32Value();
     }
     
-    GetConnectionsWorker* worker = new GetConnectionsWorker(env, m_sender, timeout);
+    GetConnectionsWorker* worker = new GetConnectionsWorker(env, m_handle, timeout);
     Napi::Promise promise = worker->m_deferred.Promise();
     worker->Queue();
     
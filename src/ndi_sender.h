@@ -25,6 +25,13 @@
 
 #include <napi.h>
 #include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include "ndi_async.h"
+#include "ndi_audio_fifo.h"
+#include "ndi_send_thread.h"
+#include "ndi_send_watcher.h"
+#include <memory>
+#include <string>
+#include <vector>
 
 class NdiSender : public Napi::ObjectWrap<NdiSender> {
 public:
@@ -40,29 +47,87 @@ private:
     static Napi::FunctionReference constructor;
     
     // Synchronous instance methods
+    Napi::Value CreateVideoFormat(const Napi::CallbackInfo& info);
+    Napi::Value AllocateVideoFrame(const Napi::CallbackInfo& info);
     Napi::Value SendVideo(const Napi::CallbackInfo& info);
     Napi::Value SendVideoAsync(const Napi::CallbackInfo& info);
     Napi::Value SendAudio(const Napi::CallbackInfo& info);
+    Napi::Value SendAudioInterleaved(const Napi::CallbackInfo& info);
+    Napi::Value StartAudioFifo(const Napi::CallbackInfo& info);
+    Napi::Value PushAudio(const Napi::CallbackInfo& info);
+    Napi::Value FlushAudio(const Napi::CallbackInfo& info);
+    Napi::Value StopAudioFifo(const Napi::CallbackInfo& info);
+    Napi::Value StartSendThread(const Napi::CallbackInfo& info);
+    Napi::Value StopSendThread(const Napi::CallbackInfo& info);
+    Napi::Value EnqueueVideo(const Napi::CallbackInfo& info);
+    Napi::Value EnqueueAudio(const Napi::CallbackInfo& info);
+    Napi::Value GetSendStats(const Napi::CallbackInfo& info);
     Napi::Value SendMetadata(const Napi::CallbackInfo& info);
     Napi::Value GetTally(const Napi::CallbackInfo& info);
     Napi::Value SetTally(const Napi::CallbackInfo& info);
     Napi::Value GetConnections(const Napi::CallbackInfo& info);
+    Napi::Value StartWatcher(const Napi::CallbackInfo& info);
+    Napi::Value StopWatcher(const Napi::CallbackInfo& info);
     Napi::Value GetSourceName(const Napi::CallbackInfo& info);
     Napi::Value ClearConnectionMetadata(const Napi::CallbackInfo& info);
     Napi::Value AddConnectionMetadata(const Napi::CallbackInfo& info);
     Napi::Value Destroy(const Napi::CallbackInfo& info);
     Napi::Value IsValid(const Napi::CallbackInfo& info);
     
+    // Send one frame through several senders in parallel
+    static Napi::Value SendVideoMulti(const Napi::CallbackInfo& info);
+    
     // Promise-based async instance methods
     Napi::Value SendVideoPromise(const Napi::CallbackInfo& info);
     Napi::Value SendAudioPromise(const Napi::CallbackInfo& info);
     Napi::Value GetTallyAsync(const Napi::CallbackInfo& info);
     Napi::Value GetConnectionsAsync(const Napi::CallbackInfo& info);
     
+    // Build a frame from (format, data, timecode?) arguments; with copy the
+    // data is copied into a new[] buffer returned through dataBuffer
+    bool VideoFrameFromFormat(
+        const Napi::CallbackInfo& info,
+        bool copy,
+        NDIlib_video_frame_v2_t& frame,
+        uint8_t** dataBuffer
+    );
+    
+    // The Buffer a frame argument's data lives in, for pinning
+    static Napi::Value FrameDataValue(const Napi::CallbackInfo& info);
+    
+    // NDI has no V210: unpack the frame to P216 in a pooled send Buffer,
+    // which replaces data as the Buffer to pin and recycle
+    static bool UnpackV210(Napi::Env env, NDIlib_video_frame_v2_t& frame, Napi::Value& data);
+    
+    // Send a frame completed by the audio FIFO, through the send thread if running
+    void SendFifoAudio(const NDIlib_audio_frame_v2_t& frame);
+    
+    // Wait for the in-flight sendVideoAsync frame and release its memory
+    void FlushAsyncVideo();
+    
+    // NDI holds an async frame until the next async send is queued, so two
+    // buffers let JS fill frame N+1 while frame N is still being encoded
+    static const size_t kAsyncVideoBufferCount = 2;
+    
     // Internal state
     NDIlib_send_instance_t m_sender;
+    SendHandle m_handle;
     bool m_destroyed;
-    uint8_t* m_asyncVideoBuffer;
+    bool m_zeroCopy;
+    bool m_clockVideo;
+    bool m_asyncVideoInFlight;
+    std::vector<uint8_t> m_asyncVideoBuffers[kAsyncVideoBufferCount];
+    size_t m_asyncVideoNext;
+    Napi::ObjectReference m_asyncVideoPinned;
+    bool m_asyncVideoRecycle;
+    
+    // Metadata of the in-flight and the next async frame, which may come
+    // from a format object that is collected while NDI still reads it
+    std::string m_asyncVideoMetadata[kAsyncVideoBufferCount];
+    size_t m_asyncMetadataNext;
+    std::unique_ptr<NdiSendThread> m_sendThread;
+    std::unique_ptr<NdiAudioFifo> m_audioFifo;
+    std::unique_ptr<NdiSendWatcher> m_watcher;
 };
 
 #endif // NDI_SENDER_H
@@ -21,10 +21,153 @@
  */
 
 #include "ndi_utils.h"
+#include "ndi_frame_pool.h"
+#include <algorithm>
+#include <cassert>
 #include <cstring>
+#include <mutex>
+#include <unordered_map>
 
 namespace NdiUtils {
 
+namespace {
+
+// Bookkeeping for a Buffer created by ExternalBuffer()
+struct ExternalBufferState {
+    size_t length;
+    ReleaseCallback release;
+};
+
+// Live external buffers by data pointer, so ReleaseBuffer() can find their state
+std::mutex g_externalMutex;
+std::unordered_map<const uint8_t*, ExternalBufferState*> g_externalBuffers;
+
+// Take ownership of the release callback if the buffer has not been released yet
+ReleaseCallback TakeRelease(const uint8_t* data, ExternalBufferState* state) {
+    std::lock_guard<std::mutex> lock(g_externalMutex);
+    auto it = g_externalBuffers.find(data);
+    if (it == g_externalBuffers.end() || (state && it->second != state)) {
+        return nullptr;
+    }
+    ReleaseCallback release = std::move(it->second->release);
+    it->second->release = nullptr;
+    g_externalBuffers.erase(it);
+    return release;
+}
+
+void FinalizeExternalBuffer(Napi::Env env, uint8_t* data, ExternalBufferState* state) {
+    ReleaseCallback release = TakeRelease(data, state);
+    if (release) {
+        release();
+        Napi::MemoryManagement::AdjustExternalMemory(env, -static_cast<int64_t>(state->length));
+    }
+    delete state;
+}
+
+Napi::Value ReleaseFrame(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!info.This().IsObject()) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    Napi::Object frame = info.This().As<Napi::Object>();
+    return Napi::Boolean::New(env, ReleaseBuffer(env, frame.Get("data")));
+}
+
+// Add the header fields shared by every audio frame object
+void SetAudioFrameFields(FrameObjectBuilder& builder, const NDIlib_audio_frame_v2_t& frame) {
+    builder.Set(FrameKeySampleRate, frame.sample_rate);
+    builder.Set(FrameKeyNoChannels, frame.no_channels);
+    builder.Set(FrameKeyNoSamples, frame.no_samples);
+    builder.Set(FrameKeyTimecode, static_cast<double>(frame.timecode));
+    builder.Set(FrameKeyChannelStrideInBytes, frame.channel_stride_in_bytes);
+    builder.Set(FrameKeyTimestamp, static_cast<double>(frame.timestamp));
+    builder.SetOptional(FrameKeyMetadata, frame.p_metadata);
+}
+
+// Add the header fields shared by every video frame object
+void SetVideoFrameFields(FrameObjectBuilder& builder, const NDIlib_video_frame_v2_t& frame) {
+    builder.Set(FrameKeyXres, frame.xres);
+    builder.Set(FrameKeyYres, frame.yres);
+    builder.SetInterned(FrameKeyFourCC, FourCCToString(frame.FourCC));
+    builder.Set(FrameKeyFrameRateN, frame.frame_rate_N);
+    builder.Set(FrameKeyFrameRateD, frame.frame_rate_D);
+    builder.Set(FrameKeyPictureAspectRatio, frame.picture_aspect_ratio);
+    builder.SetInterned(FrameKeyFrameFormatType, FrameFormatToString(frame.frame_format_type));
+    builder.Set(FrameKeyTimecode, static_cast<double>(frame.timecode));
+    builder.Set(FrameKeyLineStrideInBytes, frame.line_stride_in_bytes);
+    builder.Set(FrameKeyTimestamp, static_cast<double>(frame.timestamp));
+    builder.SetOptional(FrameKeyMetadata, frame.p_metadata);
+}
+
+const char* const kFrameKeyNames[FrameKeyCount] = {
+    "xres",
+    "yres",
+    "fourCC",
+    "frameRateN",
+    "frameRateD",
+    "pictureAspectRatio",
+    "frameFormatType",
+    "frameFormat",
+    "timecode",
+    "lineStrideInBytes",
+    "lineStride",
+    "timestamp",
+    "metadata",
+    "data",
+    "release",
+    "sampleRate",
+    "noChannels",
+    "noSamples",
+    "channelStrideInBytes",
+    "channelStride",
+    "type",
+    "video",
+    "audio",
+    "proxy",
+    "length"
+};
+
+// Interned values beyond this are created per frame instead
+const size_t kMaxInternedValues = 64;
+
+// Writable, enumerable and configurable, like a plain assignment
+const napi_property_attributes kFieldAttributes =
+    static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable);
+
+/**
+ * Interned strings for one environment, stored as instance data. Before
+ * Node-API 10 references can only point at objects, so the strings live in
+ * a persistent array: the frame keys first, then values by first use. The
+ * shared frame.release() function lives here too, since a function belongs
+ * to the environment that created it.
+ */
+struct InternedStrings {
+    Napi::ObjectReference array;
+    std::unordered_map<std::string, uint32_t> values;
+    Napi::FunctionReference releaseFunction;
+};
+
+InternedStrings* GetInternedStrings(Napi::Env env) {
+    InternedStrings* strings = env.GetInstanceData<InternedStrings>();
+    if (strings) {
+        return strings;
+    }
+    
+    Napi::Array array = Napi::Array::New(env, FrameKeyCount);
+    for (uint32_t i = 0; i < FrameKeyCount; i++) {
+        array.Set(i, Napi::String::New(env, kFrameKeyNames[i]));
+    }
+    
+    strings = new InternedStrings();
+    strings->array.Reset(array, 1);
+    env.SetInstanceData(strings);
+    return strings;
+}
+
+} // namespace
+
 Napi::Object SourceToObject(Napi::Env env, const NDIlib_source_t& source) {
     Napi::Object obj = Napi::Object::New(env);
     obj.Set("name", source.p_ndi_name ? Napi::String::New(env, source.p_ndi_name) : env.Null());
@@ -53,31 +196,163 @@ NDIlib_source_t ObjectToSource(Napi::Env env, const Napi::Object& obj) {
 }
 
 Napi::Object VideoFrameToObject(Napi::Env env, const NDIlib_video_frame_v2_t& frame) {
-    Napi::Object obj = Napi::Object::New(env);
-    
-    obj.Set("xres", Napi::Number::New(env, frame.xres));
-    obj.Set("yres", Napi::Number::New(env, frame.yres));
-    obj.Set("fourCC", Napi::String::New(env, FourCCToString(frame.FourCC)));
-    obj.Set("frameRateN", Napi::Number::New(env, frame.frame_rate_N));
-    obj.Set("frameRateD", Napi::Number::New(env, frame.frame_rate_D));
-    obj.Set("pictureAspectRatio", Napi::Number::New(env, frame.picture_aspect_ratio));
-    obj.Set("frameFormatType", Napi::String::New(env, FrameFormatToString(frame.frame_format_type)));
-    obj.Set("timecode", Napi::Number::New(env, static_cast<double>(frame.timecode)));
-    obj.Set("lineStrideInBytes", Napi::Number::New(env, frame.line_stride_in_bytes));
-    obj.Set("timestamp", Napi::Number::New(env, static_cast<double>(frame.timestamp)));
+    // Copy video data into a pooled buffer
+    FramePayload payload;
+    NdiFramePool::CopyVideoFrame(frame, payload);
+    return VideoFrameToObject(env, frame, payload);
+}
+
+Napi::Object VideoFrameToObject(Napi::Env env, const NDIlib_video_frame_v2_t& frame, FramePayload& payload) {
+    FrameObjectBuilder builder(env);
+    SetVideoFrameFields(builder, frame);
     
-    if (frame.p_metadata) {
-        obj.Set("metadata", Napi::String::New(env, frame.p_metadata));
+    if (!payload.Empty()) {
+        builder.Set(FrameKeyData, payload.ToBuffer(env));
+        builder.Set(FrameKeyRelease, FrameReleaseFunction(env));
+    } else {
+        builder.Set(FrameKeyData, env.Undefined());
+        builder.Set(FrameKeyRelease, env.Undefined());
     }
     
-    // Copy video data to a buffer
+    // Filled in by receivers with a proxy option; present either way so
+    // every video frame has the same shape
+    builder.Set(FrameKeyProxy, env.Undefined());
+    
+    return builder.Build();
+}
+
+Napi::Object VideoFrameToObject(Napi::Env env, const NDIlib_video_frame_v2_t& frame, ReleaseCallback release) {
+    FrameObjectBuilder builder(env);
+    SetVideoFrameFields(builder, frame);
+    
+    // Hand the NDI-owned video data to JavaScript as-is
     if (frame.p_data && frame.yres > 0 && frame.line_stride_in_bytes > 0) {
-        size_t dataSize = static_cast<size_t>(frame.yres) * static_cast<size_t>(frame.line_stride_in_bytes);
-        Napi::Buffer<uint8_t> buffer = Napi::Buffer<uint8_t>::Copy(env, frame.p_data, dataSize);
-        obj.Set("data", buffer);
+        builder.Set(FrameKeyData, ExternalBuffer(env, frame.p_data, VideoFrameDataSize(frame), std::move(release)));
+        builder.Set(FrameKeyRelease, FrameReleaseFunction(env));
+    } else {
+        if (release) {
+            release();
+        }
+        builder.Set(FrameKeyData, env.Undefined());
+        builder.Set(FrameKeyRelease, env.Undefined());
     }
     
-    return obj;
+    builder.Set(FrameKeyProxy, env.Undefined());
+    
+    return builder.Build();
+}
+
+Napi::Object VideoFrameHeaderToObject(Napi::Env env, const NDIlib_video_frame_v2_t& frame) {
+    FrameObjectBuilder builder(env);
+    SetVideoFrameFields(builder, frame);
+    return builder.Build();
+}
+
+int DefaultLineStride(NDIlib_FourCC_video_type_e fourCC, int xres) {
+    if (fourCC == FourCCVideoV210) {
+        // 16 bytes per 6 pixels, rounded up to whole 128-byte blocks of 48
+        return (xres + 47) / 48 * 128;
+    }
+    
+    switch (fourCC) {
+        case NDIlib_FourCC_video_type_UYVY:
+        case NDIlib_FourCC_video_type_UYVA:
+        case NDIlib_FourCC_video_type_P216:
+        case NDIlib_FourCC_video_type_PA16:
+            return xres * 2;
+        
+        case NDIlib_FourCC_video_type_YV12:
+        case NDIlib_FourCC_video_type_I420:
+        case NDIlib_FourCC_video_type_NV12:
+            return xres;
+        
+        default:
+            return xres * 4;
+    }
+}
+
+size_t VideoFrameDataSize(const NDIlib_video_frame_v2_t& frame) {
+    if (frame.yres <= 0 || frame.line_stride_in_bytes <= 0) {
+        return 0;
+    }
+    
+    size_t plane = static_cast<size_t>(frame.line_stride_in_bytes) * frame.yres;
+    
+    // Not NDI FourCCs, so outside the switch: a float Y plane followed by U
+    // and V planes of half its stride, then for FA16 a float alpha plane
+    if (frame.FourCC == FourCCVideoF216) {
+        return plane * 2;
+    }
+    if (frame.FourCC == FourCCVideoFA16) {
+        return plane * 3;
+    }
+    
+    switch (frame.FourCC) {
+        case NDIlib_FourCC_video_type_UYVA:
+            // UYVY plane followed by an 8-bit alpha plane at half its stride
+            return plane + static_cast<size_t>(frame.line_stride_in_bytes / 2) * frame.yres;
+        
+        case NDIlib_FourCC_video_type_P216:
+            // 16-bit Y plane followed by an interleaved 16-bit UV plane of the same size
+            return plane * 2;
+        
+        case NDIlib_FourCC_video_type_PA16:
+            // P216 followed by a 16-bit alpha plane
+            return plane * 3;
+        
+        case NDIlib_FourCC_video_type_YV12:
+        case NDIlib_FourCC_video_type_I420:
+        case NDIlib_FourCC_video_type_NV12:
+            // Full-resolution Y plane plus quarter-resolution chroma
+            return plane + plane / 2;
+        
+        default:
+            return plane;
+    }
+}
+
+size_t CopyVideoFrameData(const NDIlib_video_frame_v2_t& frame, uint8_t* dst, size_t capacity) {
+    if (!frame.p_data || frame.yres <= 0 || frame.line_stride_in_bytes <= 0) {
+        return 0;
+    }
+    
+    // Planes follow each other in one block, so a frame that fits is one copy
+    size_t size = VideoFrameDataSize(frame);
+    if (size <= capacity) {
+        memcpy(dst, frame.p_data, size);
+        return size;
+    }
+    
+    size_t stride = static_cast<size_t>(frame.line_stride_in_bytes);
+    size_t lines = std::min(static_cast<size_t>(frame.yres), capacity / stride);
+    memcpy(dst, frame.p_data, lines * stride);
+    return lines * stride;
+}
+
+bool IsPackedHeader(Napi::Value value, size_t length) {
+    if (!value.IsTypedArray()) {
+        return false;
+    }
+    
+    Napi::TypedArray header = value.As<Napi::TypedArray>();
+    napi_typedarray_type type = header.TypedArrayType();
+    
+    return (type == napi_bigint64_array || type == napi_float64_array) &&
+           header.ElementLength() >= length;
+}
+
+void WritePackedHeader(Napi::TypedArray header, const int64_t* fields, size_t count) {
+    uint8_t* base = static_cast<uint8_t*>(header.ArrayBuffer().Data()) + header.ByteOffset();
+    
+    if (header.TypedArrayType() == napi_bigint64_array) {
+        memcpy(base, fields, count * sizeof(int64_t));
+        return;
+    }
+    
+    double* dst = reinterpret_cast<double*>(base);
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = static_cast<double>(fields[i]);
+    }
 }
 
 NDIlib_video_frame_v2_t ObjectToVideoFrame(Napi::Env env, const Napi::Object& obj, uint8_t** dataBuffer) {
@@ -119,48 +394,72 @@ NDIlib_video_frame_v2_t ObjectToVideoFrame(Napi::Env env, const Napi::Object& ob
     if (obj.Has("lineStrideInBytes")) {
         frame.line_stride_in_bytes = obj.Get("lineStrideInBytes").As<Napi::Number>().Int32Value();
     } else {
-        // Calculate default stride based on format
-        int bytesPerPixel = 4; // Default for BGRA/RGBA
-        if (frame.FourCC == NDIlib_FourCC_video_type_UYVY) {
-            bytesPerPixel = 2;
-        }
-        frame.line_stride_in_bytes = frame.xres * bytesPerPixel;
+        frame.line_stride_in_bytes = DefaultLineStride(frame.FourCC, frame.xres);
     }
     
     // Handle video data buffer
     if (obj.Has("data") && obj.Get("data").IsBuffer()) {
         Napi::Buffer<uint8_t> buffer = obj.Get("data").As<Napi::Buffer<uint8_t>>();
-        size_t dataSize = buffer.Length();
-        *dataBuffer = new uint8_t[dataSize];
-        memcpy(*dataBuffer, buffer.Data(), dataSize);
-        frame.p_data = *dataBuffer;
+        
+        // NDI reads every plane from the stride and height alone, so a short
+        // Buffer would be read past its end
+        if (buffer.Length() < VideoFrameDataSize(frame)) {
+            Napi::RangeError::New(env, "Video data is smaller than its fourCC, yres and line stride need")
+                .ThrowAsJavaScriptException();
+            return frame;
+        }
+        
+        if (dataBuffer) {
+            size_t dataSize = buffer.Length();
+            *dataBuffer = new uint8_t[dataSize];
+            memcpy(*dataBuffer, buffer.Data(), dataSize);
+            frame.p_data = *dataBuffer;
+        } else {
+            frame.p_data = buffer.Data();
+        }
     }
     
     return frame;
 }
 
 Napi::Object AudioFrameToObject(Napi::Env env, const NDIlib_audio_frame_v2_t& frame) {
-    Napi::Object obj = Napi::Object::New(env);
-    
-    obj.Set("sampleRate", Napi::Number::New(env, frame.sample_rate));
-    obj.Set("noChannels", Napi::Number::New(env, frame.no_channels));
-    obj.Set("noSamples", Napi::Number::New(env, frame.no_samples));
-    obj.Set("timecode", Napi::Number::New(env, static_cast<double>(frame.timecode)));
-    obj.Set("channelStrideInBytes", Napi::Number::New(env, frame.channel_stride_in_bytes));
-    obj.Set("timestamp", Napi::Number::New(env, static_cast<double>(frame.timestamp)));
+    FrameObjectBuilder builder(env);
+    SetAudioFrameFields(builder, frame);
+    
+    // Copy audio data into a pooled buffer (planar float format)
+    FramePayload payload;
+    NdiFramePool::CopyAudioFrame(frame, payload);
+    if (!payload.Empty()) {
+        builder.Set(FrameKeyData, payload.ToBuffer(env));
+        builder.Set(FrameKeyRelease, FrameReleaseFunction(env));
+    } else {
+        builder.Set(FrameKeyData, env.Undefined());
+        builder.Set(FrameKeyRelease, env.Undefined());
+    }
     
-    if (frame.p_metadata) {
-        obj.Set("metadata", Napi::String::New(env, frame.p_metadata));
+    return builder.Build();
+}
+
+Napi::Object AudioFrameHeaderToObject(Napi::Env env, const NDIlib_audio_frame_v2_t& frame) {
+    FrameObjectBuilder builder(env);
+    SetAudioFrameFields(builder, frame);
+    return builder.Build();
+}
+
+int CopyAudioFrameData(const NDIlib_audio_frame_v2_t& frame, float* dst, size_t capacity) {
+    if (!frame.p_data || frame.no_channels <= 0 || frame.no_samples <= 0) {
+        return 0;
     }
     
-    // Copy audio data to a buffer (planar float format)
-    if (frame.p_data && frame.no_channels > 0 && frame.no_samples > 0) {
-        size_t dataSize = static_cast<size_t>(frame.no_channels) * static_cast<size_t>(frame.channel_stride_in_bytes);
-        Napi::Buffer<float> buffer = Napi::Buffer<float>::Copy(env, frame.p_data, dataSize / sizeof(float));
-        obj.Set("data", buffer);
+    size_t channels = static_cast<size_t>(frame.no_channels);
+    size_t samples = std::min(static_cast<size_t>(frame.no_samples), capacity / channels);
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(frame.p_data);
+    
+    for (size_t ch = 0; ch < channels; ch++) {
+        memcpy(dst + ch * samples, src + ch * frame.channel_stride_in_bytes, samples * sizeof(float));
     }
     
-    return obj;
+    return static_cast<int>(samples);
 }
 
 NDIlib_audio_frame_v2_t ObjectToAudioFrame(Napi::Env env, const Napi::Object& obj, float** dataBuffer) {
@@ -187,26 +486,25 @@ NDIlib_audio_frame_v2_t ObjectToAudioFrame(Napi::Env env, const Napi::Object& ob
     // Handle audio data buffer
     if (obj.Has("data") && obj.Get("data").IsBuffer()) {
         Napi::Buffer<float> buffer = obj.Get("data").As<Napi::Buffer<float>>();
-        size_t dataSize = buffer.Length();
-        *dataBuffer = new float[dataSize];
-        memcpy(*dataBuffer, buffer.Data(), dataSize * sizeof(float));
-        frame.p_data = *dataBuffer;
+        if (dataBuffer) {
+            size_t dataSize = buffer.Length();
+            *dataBuffer = new float[dataSize];
+            memcpy(*dataBuffer, buffer.Data(), dataSize * sizeof(float));
+            frame.p_data = *dataBuffer;
+        } else {
+            frame.p_data = buffer.Data();
+        }
     }
     
     return frame;
 }
 
 Napi::Object MetadataFrameToObject(Napi::Env env, const NDIlib_metadata_frame_t& frame) {
-    Napi::Object obj = Napi::Object::New(env);
-    
-    obj.Set("length", Napi::Number::New(env, frame.length));
-    obj.Set("timecode", Napi::Number::New(env, static_cast<double>(frame.timecode)));
-    
-    if (frame.p_data) {
-        obj.Set("data", Napi::String::New(env, frame.p_data));
-    }
-    
-    return obj;
+    FrameObjectBuilder builder(env);
+    builder.Set(FrameKeyLength, frame.length);
+    builder.Set(FrameKeyTimecode, static_cast<double>(frame.timecode));
+    builder.SetOptional(FrameKeyData, frame.p_data);
+    return builder.Build();
 }
 
 NDIlib_metadata_frame_t ObjectToMetadataFrame(Napi::Env env, const Napi::Object& obj, char** dataBuffer) {
@@ -227,6 +525,21 @@ NDIlib_metadata_frame_t ObjectToMetadataFrame(Napi::Env env, const Napi::Object&
     return frame;
 }
 
+Napi::Object CaptureResultToObject(
+    Napi::Env env,
+    NDIlib_frame_type_e type,
+    Napi::Value video,
+    Napi::Value audio,
+    Napi::Value metadata
+) {
+    FrameObjectBuilder builder(env);
+    builder.SetInterned(FrameKeyType, FrameTypeToString(type));
+    builder.Set(FrameKeyVideo, video);
+    builder.Set(FrameKeyAudio, audio);
+    builder.Set(FrameKeyMetadata, metadata);
+    return builder.Build();
+}
+
 Napi::Object TallyToObject(Napi::Env env, const NDIlib_tally_t& tally) {
     Napi::Object obj = Napi::Object::New(env);
     obj.Set("onProgram", Napi::Boolean::New(env, tally.on_program));
@@ -248,27 +561,166 @@ NDIlib_tally_t ObjectToTally(Napi::Env env, const Napi::Object& obj) {
     return tally;
 }
 
+Napi::Buffer<uint8_t> ExternalBuffer(Napi::Env env, uint8_t* data, size_t length, ReleaseCallback release) {
+    ExternalBufferState* state = new ExternalBufferState{length, std::move(release)};
+    
+    {
+        std::lock_guard<std::mutex> lock(g_externalMutex);
+        g_externalBuffers[data] = state;
+    }
+    
+    Napi::MemoryManagement::AdjustExternalMemory(env, static_cast<int64_t>(length));
+    
+    // Runtimes that forbid external buffers (e.g. Electron) get a copy, in which
+    // case the finalizer runs immediately and the native memory is released
+    return Napi::Buffer<uint8_t>::NewOrCopy(env, data, length, FinalizeExternalBuffer, state);
+}
+
+bool ReleaseBuffer(Napi::Env env, Napi::Value value) {
+    if (!value.IsTypedArray()) {
+        return false;
+    }
+    
+    // Buffers and Float32Arrays alike are views over the external ArrayBuffer
+    Napi::ArrayBuffer buffer = value.As<Napi::TypedArray>().ArrayBuffer();
+    const uint8_t* data = static_cast<const uint8_t*>(buffer.Data());
+    size_t length = buffer.ByteLength();
+    
+    {
+        std::lock_guard<std::mutex> lock(g_externalMutex);
+        if (g_externalBuffers.find(data) == g_externalBuffers.end()) {
+            return false;
+        }
+    }
+    
+    // Detach first so JavaScript can never observe the freed memory
+    if (napi_detach_arraybuffer(env, buffer) != napi_ok) {
+        return false;
+    }
+    
+    // Detaching may already have run the finalizer, which released the memory itself
+    ReleaseCallback release = TakeRelease(data, nullptr);
+    if (release) {
+        release();
+        Napi::MemoryManagement::AdjustExternalMemory(env, -static_cast<int64_t>(length));
+    }
+    
+    return true;
+}
+
+void FramePayload::Reset() {
+    if (release) {
+        release();
+    }
+    release = nullptr;
+    data = nullptr;
+    size = 0;
+}
+
+Napi::Buffer<uint8_t> FramePayload::ToBuffer(Napi::Env env) {
+    Napi::Buffer<uint8_t> buffer = ExternalBuffer(env, data, size, std::move(release));
+    release = nullptr;
+    data = nullptr;
+    size = 0;
+    return buffer;
+}
+
+Napi::Float32Array FramePayload::ToFloat32Array(Napi::Env env) {
+    size_t count = size / sizeof(float);
+    Napi::Buffer<uint8_t> buffer = ToBuffer(env);
+    return Napi::Float32Array::New(env, count, buffer.ArrayBuffer(), buffer.ByteOffset());
+}
+
+Napi::Function FrameReleaseFunction(Napi::Env env) {
+    InternedStrings* strings = GetInternedStrings(env);
+    if (strings->releaseFunction.IsEmpty()) {
+        strings->releaseFunction.Reset(Napi::Function::New(env, ReleaseFrame, "release"), 1);
+    }
+    return strings->releaseFunction.Value();
+}
+
+FrameObjectBuilder::FrameObjectBuilder(Napi::Env env)
+    : m_env(env), m_strings(GetInternedStrings(env)->array.Value()), m_count(0) {
+}
+
+void FrameObjectBuilder::Set(FrameKey key, napi_value value) {
+    assert(m_count < FrameKeyCount);
+    
+    napi_property_descriptor& field = m_fields[m_count++];
+    field = napi_property_descriptor();
+    field.name = m_strings.Get(static_cast<uint32_t>(key));
+    field.value = value;
+    field.attributes = kFieldAttributes;
+}
+
+void FrameObjectBuilder::Set(FrameKey key, double value) {
+    Set(key, Napi::Number::New(m_env, value));
+}
+
+void FrameObjectBuilder::SetInterned(FrameKey key, const std::string& value) {
+    InternedStrings* strings = GetInternedStrings(m_env);
+    
+    auto it = strings->values.find(value);
+    if (it != strings->values.end()) {
+        Set(key, m_strings.Get(it->second));
+        return;
+    }
+    
+    Napi::String str = Napi::String::New(m_env, value);
+    if (strings->values.size() < kMaxInternedValues) {
+        uint32_t index = static_cast<uint32_t>(FrameKeyCount + strings->values.size());
+        m_strings.Set(index, str);
+        strings->values[value] = index;
+    }
+    Set(key, str);
+}
+
+void FrameObjectBuilder::SetOptional(FrameKey key, const char* value) {
+    if (value) {
+        Set(key, Napi::String::New(m_env, value));
+    } else {
+        Set(key, m_env.Undefined());
+    }
+}
+
+Napi::Object FrameObjectBuilder::Build() {
+    Napi::Object obj = Napi::Object::New(m_env);
+    napi_define_properties(m_env, obj, m_count, m_fields);
+    return obj;
+}
+
 NDIlib_FourCC_video_type_e StringToFourCC(const std::string& str) {
     if (str == "UYVY") return NDIlib_FourCC_video_type_UYVY;
     if (str == "BGRA") return NDIlib_FourCC_video_type_BGRA;
     if (str == "BGRX") return NDIlib_FourCC_video_type_BGRX;
     if (str == "RGBA") return NDIlib_FourCC_video_type_RGBA;
     if (str == "RGBX") return NDIlib_FourCC_video_type_RGBX;
+    if (str == "UYVA") return NDIlib_FourCC_video_type_UYVA;
     if (str == "I420") return NDIlib_FourCC_video_type_I420;
+    if (str == "YV12") return NDIlib_FourCC_video_type_YV12;
     if (str == "NV12") return NDIlib_FourCC_video_type_NV12;
     if (str == "P216") return NDIlib_FourCC_video_type_P216;
     if (str == "PA16") return NDIlib_FourCC_video_type_PA16;
+    if (str == "F216") return FourCCVideoF216;
+    if (str == "FA16") return FourCCVideoFA16;
+    if (str == "V210") return FourCCVideoV210;
     return NDIlib_FourCC_video_type_BGRA; // Default
 }
 
 std::string FourCCToString(NDIlib_FourCC_video_type_e fourcc) {
+    if (fourcc == FourCCVideoF216) return "F216";
+    if (fourcc == FourCCVideoFA16) return "FA16";
+    if (fourcc == FourCCVideoV210) return "V210";
+    
     switch (fourcc) {
         case NDIlib_FourCC_video_type_UYVY: return "UYVY";
         case NDIlib_FourCC_video_type_BGRA: return "BGRA";
         case NDIlib_FourCC_video_type_BGRX: return "BGRX";
         case NDIlib_FourCC_video_type_RGBA: return "RGBA";
         case NDIlib_FourCC_video_type_RGBX: return "RGBX";
+        case NDIlib_FourCC_video_type_UYVA: return "UYVA";
         case NDIlib_FourCC_video_type_I420: return "I420";
+        case NDIlib_FourCC_video_type_YV12: return "YV12";
         case NDIlib_FourCC_video_type_NV12: return "NV12";
         case NDIlib_FourCC_video_type_P216: return "P216";
         case NDIlib_FourCC_video_type_PA16: return "PA16";
@@ -25,9 +25,53 @@
 
 #include <napi.h>
 #include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include <functional>
 
 namespace NdiUtils {
 
+// Planar float versions of P216 and PA16 (Y, U, V and alpha planes of 32-bit
+// floats in 0..1) that conversion produces; these never go to NDI
+const NDIlib_FourCC_video_type_e FourCCVideoF216 =
+    static_cast<NDIlib_FourCC_video_type_e>(NDI_LIB_FOURCC('F', '2', '1', '6'));
+const NDIlib_FourCC_video_type_e FourCCVideoFA16 =
+    static_cast<NDIlib_FourCC_video_type_e>(NDI_LIB_FOURCC('F', 'A', '1', '6'));
+
+// 10-bit 4:2:2 packed as SDI hardware uses it, six pixels in four 32-bit
+// words with lines padded to 128 bytes. NDI has no such format, so it only
+// ever passes through the SDK's P216 utilities.
+const NDIlib_FourCC_video_type_e FourCCVideoV210 =
+    static_cast<NDIlib_FourCC_video_type_e>(NDI_LIB_FOURCC('V', '2', '1', '0'));
+
+// Frees natively-owned frame memory once JavaScript no longer needs it
+typedef std::function<void()> ReleaseCallback;
+
+/**
+ * Frame data owned natively until it is handed to JavaScript. The release
+ * callback frees it exactly once: on Reset(), on destruction, or through
+ * the Buffer returned by ToBuffer().
+ */
+struct FramePayload {
+    uint8_t* data = nullptr;
+    size_t size = 0;
+    ReleaseCallback release;
+    
+    FramePayload() = default;
+    FramePayload(const FramePayload&) = delete;
+    FramePayload& operator=(const FramePayload&) = delete;
+    ~FramePayload() { Reset(); }
+    
+    bool Empty() const { return data == nullptr; }
+    
+    // Free the data if it has not been handed off
+    void Reset();
+    
+    // Transfer ownership of the data to a JavaScript Buffer
+    Napi::Buffer<uint8_t> ToBuffer(Napi::Env env);
+    
+    // Transfer ownership of float sample data to a JavaScript Float32Array
+    Napi::Float32Array ToFloat32Array(Napi::Env env);
+};
+
 // Convert NDI source to JavaScript object
 Napi::Object SourceToObject(Napi::Env env, const NDIlib_source_t& source);
 
@@ -37,13 +81,78 @@ NDIlib_source_t ObjectToSource(Napi::Env env, const Napi::Object& obj);
 // Convert NDI video frame to JavaScript object
 Napi::Object VideoFrameToObject(Napi::Env env, const NDIlib_video_frame_v2_t& frame);
 
-// Convert JavaScript object to NDI video frame
+// Convert NDI video frame to JavaScript object without copying: the data Buffer
+// wraps frame.p_data and release is called once the Buffer is no longer used
+Napi::Object VideoFrameToObject(Napi::Env env, const NDIlib_video_frame_v2_t& frame, ReleaseCallback release);
+
+// Convert NDI video frame to JavaScript object whose data Buffer takes over
+// payload, which must hold the frame's data
+Napi::Object VideoFrameToObject(Napi::Env env, const NDIlib_video_frame_v2_t& frame, FramePayload& payload);
+
+// Convert NDI video frame header fields (everything except data) to JavaScript object
+Napi::Object VideoFrameHeaderToObject(Napi::Env env, const NDIlib_video_frame_v2_t& frame);
+
+// Line stride of a tightly packed frame; for planar formats, of the first plane
+int DefaultLineStride(NDIlib_FourCC_video_type_e fourCC, int xres);
+
+// Bytes of data a video frame of this FourCC, size and stride points at
+size_t VideoFrameDataSize(const NDIlib_video_frame_v2_t& frame);
+
+// Copy the whole frame, every plane, into dst if it fits, otherwise as many
+// whole lines of the first plane as do; returns bytes written
+size_t CopyVideoFrameData(const NDIlib_video_frame_v2_t& frame, uint8_t* dst, size_t capacity);
+
+// Field indices of the packed video header written by captureVideoPacked()
+enum VideoHeaderField {
+    VideoHeaderXres,
+    VideoHeaderYres,
+    VideoHeaderFourCC,
+    VideoHeaderFrameRateN,
+    VideoHeaderFrameRateD,
+    VideoHeaderFrameFormat,
+    VideoHeaderLineStride,
+    VideoHeaderTimecode,
+    VideoHeaderTimestamp,
+    VideoHeaderDataSize,
+    VideoHeaderBytesWritten,
+    VideoHeaderLength
+};
+
+// Field indices of the packed audio header written by captureAudioPacked()
+enum AudioHeaderField {
+    AudioHeaderSampleRate,
+    AudioHeaderNoChannels,
+    AudioHeaderNoSamples,
+    AudioHeaderTimecode,
+    AudioHeaderTimestamp,
+    AudioHeaderDataSize,
+    AudioHeaderSamplesWritten,
+    AudioHeaderLength
+};
+
+// True for a BigInt64Array or Float64Array with room for length fields
+bool IsPackedHeader(Napi::Value value, size_t length);
+
+// Write header fields into a BigInt64Array (exact) or Float64Array in place
+void WritePackedHeader(Napi::TypedArray header, const int64_t* fields, size_t count);
+
+// Convert JavaScript object to NDI video frame. The data is copied into a
+// new[] buffer returned through dataBuffer; pass null to point p_data at the
+// caller's Buffer instead, which must then outlive the send. Throws, leaving
+// p_data null, if the Buffer is smaller than VideoFrameDataSize()
 NDIlib_video_frame_v2_t ObjectToVideoFrame(Napi::Env env, const Napi::Object& obj, uint8_t** dataBuffer);
 
 // Convert NDI audio frame to JavaScript object
 Napi::Object AudioFrameToObject(Napi::Env env, const NDIlib_audio_frame_v2_t& frame);
 
-// Convert JavaScript object to NDI audio frame
+// Convert NDI audio frame header fields (everything except data) to JavaScript object
+Napi::Object AudioFrameHeaderToObject(Napi::Env env, const NDIlib_audio_frame_v2_t& frame);
+
+// Copy planar audio into dst (capacity in floats). Every channel gets the same number
+// of leading samples, packed back to back; returns the samples written per channel.
+int CopyAudioFrameData(const NDIlib_audio_frame_v2_t& frame, float* dst, size_t capacity);
+
+// Convert JavaScript object to NDI audio frame (dataBuffer as for video)
 NDIlib_audio_frame_v2_t ObjectToAudioFrame(Napi::Env env, const Napi::Object& obj, float** dataBuffer);
 
 // Convert NDI metadata frame to JavaScript object
@@ -52,12 +161,93 @@ Napi::Object MetadataFrameToObject(Napi::Env env, const NDIlib_metadata_frame_t&
 // Convert JavaScript object to NDI metadata frame
 NDIlib_metadata_frame_t ObjectToMetadataFrame(Napi::Env env, const Napi::Object& obj, char** dataBuffer);
 
+// Build the { type, video, audio, metadata } capture result; absent frames are undefined
+Napi::Object CaptureResultToObject(
+    Napi::Env env,
+    NDIlib_frame_type_e type,
+    Napi::Value video,
+    Napi::Value audio,
+    Napi::Value metadata
+);
+
 // Convert NDI tally to JavaScript object
 Napi::Object TallyToObject(Napi::Env env, const NDIlib_tally_t& tally);
 
 // Convert JavaScript object to NDI tally
 NDIlib_tally_t ObjectToTally(Napi::Env env, const Napi::Object& obj);
 
+// Wrap natively-owned memory in a Buffer without copying. The release callback runs
+// exactly once: when the Buffer is garbage collected or when ReleaseBuffer() is called.
+Napi::Buffer<uint8_t> ExternalBuffer(Napi::Env env, uint8_t* data, size_t length, ReleaseCallback release);
+
+// Release the memory behind a Buffer created by ExternalBuffer(), or a typed array
+// over its ArrayBuffer, early and detach it.
+// Returns false if the value is not such a view or has already been released.
+bool ReleaseBuffer(Napi::Env env, Napi::Value value);
+
+// Shared `release()` method for frame objects, frees `this.data` early
+Napi::Function FrameReleaseFunction(Napi::Env env);
+
+// Property names used on frame objects, interned once per environment
+enum FrameKey {
+    FrameKeyXres,
+    FrameKeyYres,
+    FrameKeyFourCC,
+    FrameKeyFrameRateN,
+    FrameKeyFrameRateD,
+    FrameKeyPictureAspectRatio,
+    FrameKeyFrameFormatType,
+    FrameKeyFrameFormat,
+    FrameKeyTimecode,
+    FrameKeyLineStrideInBytes,
+    FrameKeyLineStride,
+    FrameKeyTimestamp,
+    FrameKeyMetadata,
+    FrameKeyData,
+    FrameKeyRelease,
+    FrameKeySampleRate,
+    FrameKeyNoChannels,
+    FrameKeyNoSamples,
+    FrameKeyChannelStrideInBytes,
+    FrameKeyChannelStride,
+    FrameKeyType,
+    FrameKeyVideo,
+    FrameKeyAudio,
+    FrameKeyProxy,
+    FrameKeyLength,
+    FrameKeyCount
+};
+
+/**
+ * Builds a frame object with one napi_define_properties call instead of a
+ * Set() per field, using interned property names and enum strings. Callers
+ * add fields in a fixed order and pass undefined for absent optional fields,
+ * so every frame of a kind gets the same hidden class.
+ */
+class FrameObjectBuilder {
+public:
+    explicit FrameObjectBuilder(Napi::Env env);
+    
+    void Set(FrameKey key, napi_value value);
+    void Set(FrameKey key, double value);
+    
+    // Interned copy of a short repeated value such as a FourCC or frame format
+    void SetInterned(FrameKey key, const std::string& value);
+    
+    // String field, undefined when value is null
+    void SetOptional(FrameKey key, const char* value);
+    
+    Napi::Object Build();
+
+private:
+    Napi::Env m_env;
+    Napi::Object m_strings;
+    
+    // Room for every key, each of which a frame sets at most once
+    napi_property_descriptor m_fields[FrameKeyCount];
+    size_t m_count;
+};
+
 // FourCC video type conversion helpers
 NDIlib_FourCC_video_type_e StringToFourCC(const std::string& str);
 std::string FourCCToString(NDIlib_FourCC_video_type_e fourcc);
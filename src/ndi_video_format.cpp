@@ -0,0 +1,138 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Video Format - Implementation
+ */
+
+#include "ndi_video_format.h"
+#include "ndi_utils.h"
+
+Napi::FunctionReference NdiVideoFormat::constructor;
+
+Napi::Object NdiVideoFormat::Init(Napi::Env env, Napi::Object exports) {
+    Napi::HandleScope scope(env);
+    
+    Napi::Function func = DefineClass(env, "NdiVideoFormat", {});
+    
+    constructor = Napi::Persistent(func);
+    constructor.SuppressDestruct();
+    
+    exports.Set("NdiVideoFormat", func);
+    return exports;
+}
+
+Napi::Object NdiVideoFormat::NewInstance(Napi::Env env, Napi::Value options) {
+    return constructor.New({ options });
+}
+
+NdiVideoFormat::NdiVideoFormat(const Napi::CallbackInfo& info)
+    : Napi::ObjectWrap<NdiVideoFormat>(info), m_frame(), m_dataSize(0) {
+    
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected video format options object").ThrowAsJavaScriptException();
+        return;
+    }
+    
+    Napi::Object options = info[0].As<Napi::Object>();
+    
+    // Same parsing and defaults as a per-frame object, minus the data
+    uint8_t* unused = nullptr;
+    m_frame = NdiUtils::ObjectToVideoFrame(env, options, &unused);
+    m_frame.p_data = nullptr;
+    delete[] unused;
+    
+    if (env.IsExceptionPending()) {
+        return;
+    }
+    
+    if (m_frame.xres <= 0 || m_frame.yres <= 0) {
+        Napi::TypeError::New(env, "Video format needs positive xres and yres").ThrowAsJavaScriptException();
+        return;
+    }
+    
+    // Every frame bound to the format is read with this stride
+    if (m_frame.line_stride_in_bytes < NdiUtils::DefaultLineStride(m_frame.FourCC, m_frame.xres)) {
+        Napi::RangeError::New(env, "lineStrideInBytes is smaller than a row of the video format").ThrowAsJavaScriptException();
+        return;
+    }
+    
+    if (options.Has("metadata") && options.Get("metadata").IsString()) {
+        m_metadata = options.Get("metadata").As<Napi::String>().Utf8Value();
+        m_frame.p_metadata = m_metadata.c_str();
+    }
+    
+    m_dataSize = NdiUtils::VideoFrameDataSize(m_frame);
+    
+    // Read-only description of what was parsed
+    Napi::Object self = info.This().As<Napi::Object>();
+    self.DefineProperties({
+        Napi::PropertyDescriptor::Value("xres", Napi::Number::New(env, m_frame.xres), napi_enumerable),
+        Napi::PropertyDescriptor::Value("yres", Napi::Number::New(env, m_frame.yres), napi_enumerable),
+        Napi::PropertyDescriptor::Value("fourCC", Napi::String::New(env, NdiUtils::FourCCToString(m_frame.FourCC)), napi_enumerable),
+        Napi::PropertyDescriptor::Value("lineStrideInBytes", Napi::Number::New(env, m_frame.line_stride_in_bytes), napi_enumerable),
+        Napi::PropertyDescriptor::Value("dataSize", Napi::Number::New(env, static_cast<double>(m_dataSize)), napi_enumerable)
+    });
+}
+
+NdiVideoFormat* NdiVideoFormat::FromValue(Napi::Value value) {
+    if (!value.IsObject() || constructor.IsEmpty()) {
+        return nullptr;
+    }
+    
+    Napi::Object obj = value.As<Napi::Object>();
+    if (!obj.InstanceOf(constructor.Value())) {
+        return nullptr;
+    }
+    
+    return Napi::ObjectWrap<NdiVideoFormat>::Unwrap(obj);
+}
+
+bool NdiVideoFormat::BindFrame(
+    Napi::Env env,
+    Napi::Value data,
+    Napi::Value timecode,
+    NDIlib_video_frame_v2_t& frame
+) const {
+    if (!data.IsTypedArray()) {
+        Napi::TypeError::New(env, "Expected video data Buffer").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    Napi::TypedArray buffer = data.As<Napi::TypedArray>();
+    if (buffer.ByteLength() < m_dataSize) {
+        Napi::Error::New(env, "Video data is smaller than the format's dataSize").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    frame = m_frame;
+    frame.p_data = static_cast<uint8_t*>(buffer.ArrayBuffer().Data()) + buffer.ByteOffset();
+    
+    // Let NDI synthesize the timecode unless one is given
+    frame.timecode = NDIlib_send_timecode_synthesize;
+    if (timecode.IsNumber()) {
+        frame.timecode = static_cast<int64_t>(timecode.As<Napi::Number>().DoubleValue());
+    } else if (timecode.IsBigInt()) {
+        bool lossless = false;
+        frame.timecode = timecode.As<Napi::BigInt>().Int64Value(&lossless);
+    }
+    
+    return true;
+}
@@ -0,0 +1,60 @@
+/*
+ * ndi-node - Node.js bindings for NDI (Network Device Interface)
+ * Copyright (C) 2025 Eyetu Kingsley Oghenekome - Technical Director, Voyager Technologies
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * NDI Video Format - Prebound video frame description for senders
+ */
+
+#ifndef NDI_VIDEO_FORMAT_H
+#define NDI_VIDEO_FORMAT_H
+
+#include <napi.h>
+#include "../deps/ndi/include/Processing.NDI.Lib.h"
+#include <string>
+
+/**
+ * Everything about a sent video frame that stays the same from frame to
+ * frame, parsed once by sender.createVideoFormat(). Sending with a format
+ * only needs the data Buffer and a timecode per frame.
+ */
+class NdiVideoFormat : public Napi::ObjectWrap<NdiVideoFormat> {
+public:
+    static Napi::Object Init(Napi::Env env, Napi::Object exports);
+    static Napi::Object NewInstance(Napi::Env env, Napi::Value options);
+    NdiVideoFormat(const Napi::CallbackInfo& info);
+    
+    // The format wrapped by value, or null if it is not an NdiVideoFormat
+    static NdiVideoFormat* FromValue(Napi::Value value);
+    
+    // Fill frame from this format plus the per-frame data and timecode. The
+    // frame points straight at the Buffer's memory. Throws and returns false
+    // if data is not a Buffer large enough for the format.
+    bool BindFrame(Napi::Env env, Napi::Value data, Napi::Value timecode, NDIlib_video_frame_v2_t& frame) const;
+    
+    size_t DataSize() const { return m_dataSize; }
+    NDIlib_FourCC_video_type_e FourCC() const { return m_frame.FourCC; }
+
+private:
+    static Napi::FunctionReference constructor;
+    
+    NDIlib_video_frame_v2_t m_frame;
+    std::string m_metadata;
+    size_t m_dataSize;
+};
+
+#endif // NDI_VIDEO_FORMAT_H
@@ -49,6 +49,8 @@ const constantTests = [
     { name: 'Bandwidth.HIGHEST', value: ndi.Bandwidth?.HIGHEST, expected: 'highest' },
     { name: 'ColorFormat.BEST', value: ndi.ColorFormat?.BEST, expected: 'best' },
     { name: 'FrameType.VIDEO', value: ndi.FrameType?.VIDEO, expected: 'video' },
+    { name: 'VideoHeader.LENGTH', value: ndi.VideoHeader?.LENGTH, expected: 11 },
+    { name: 'AudioHeader.LENGTH', value: ndi.AudioHeader?.LENGTH, expected: 7 },
 ];
 
 constantTests.forEach(test => {
@@ -74,7 +76,13 @@ classTests.forEach(className => {
 // Test 4: Core functions are defined
 console.log('\n--- Testing Core Functions ---');
 
-const functionTests = ['initialize', 'destroy', 'isInitialized', 'version', 'find'];
+const functionTests = [
+    'initialize', 'destroy', 'isInitialized', 'version', 'find',
+    'setFramePoolOptions', 'getFramePoolStats',
+    'configureThreadPool', 'getThreadPoolStats',
+    'convertVideo', 'convertVideoAsync', 'getConvertImplementation',
+    'scaleVideo'
+];
 functionTests.forEach(funcName => {
     if (typeof ndi[funcName] === 'function') {
         console.log(`✓ ${funcName}() function exists`);
@@ -83,7 +91,129 @@ functionTests.forEach(funcName => {
     }
 });
 
-// Test 5: Initialize and version (requires NDI SDK)
+// Test 5: SIMD conversion matches the scalar reference
+console.log('\n--- Testing Pixel Conversion ---');
+
+try {
+    console.log(`✓ Conversion kernels: ${ndi.getConvertImplementation()}`);
+
+    // Odd pair counts and a padded stride exercise the kernels' tail paths
+    const xres = 98;
+    const yres = 5;
+    const uyvy = {
+        xres, yres, fourCC: 'UYVY', lineStrideInBytes: xres * 2 + 12,
+        data: Buffer.alloc((xres * 2 + 12) * yres)
+    };
+    for (let i = 0; i < uyvy.data.length; i++) {
+        uyvy.data[i] = (i * 131 + 7) & 0xFF;
+    }
+
+    const rgba = ndi.convertVideo(uyvy, 'RGBA');
+    const rgbaReference = ndi.convertVideo(uyvy, 'RGBA', { reference: true });
+    if (rgba.lineStrideInBytes === xres * 4 && rgba.data.equals(rgbaReference.data)) {
+        console.log('✓ UYVY -> RGBA matches the scalar reference');
+    } else {
+        console.log('✗ UYVY -> RGBA differs from the scalar reference');
+    }
+
+    const back = ndi.convertVideo(rgba, 'UYVY');
+    const backReference = ndi.convertVideo(rgba, 'UYVY', { reference: true });
+    if (back.lineStrideInBytes === xres * 2 && back.data.equals(backReference.data)) {
+        console.log('✓ RGBA -> UYVY matches the scalar reference');
+    } else {
+        console.log('✗ RGBA -> UYVY differs from the scalar reference');
+    }
+
+    // 4:2:0 keeps one chroma line per pair, so planar -> UYVY -> planar is exact
+    const nv12 = {
+        xres, yres: 4, fourCC: 'NV12',
+        data: Buffer.alloc(xres * 4 * 3 / 2)
+    };
+    for (let i = 0; i < nv12.data.length; i++) {
+        nv12.data[i] = (i * 37 + 11) & 0xFF;
+    }
+
+    const nv12Uyvy = ndi.convertVideo(nv12, 'UYVY');
+    const i420 = ndi.convertVideo(nv12Uyvy, 'I420');
+    const nv12Back = ndi.convertVideo(i420, 'NV12');
+    if (nv12Back.data.equals(nv12.data) &&
+        nv12Uyvy.data.equals(ndi.convertVideo(nv12, 'UYVY', { reference: true }).data)) {
+        console.log('✓ NV12 -> UYVY -> I420 -> NV12 round trips exactly');
+    } else {
+        console.log('✗ NV12 round trip changed the frame');
+    }
+
+    // P216: 16-bit luma plane, then interleaved 16-bit UV of the same size
+    const p216 = {
+        xres, yres: 3, fourCC: 'P216',
+        data: Buffer.alloc(xres * 2 * 3 * 2)
+    };
+    for (let i = 0; i < p216.data.length; i++) {
+        p216.data[i] = (i * 59 + 3) & 0xFF;
+    }
+
+    const narrowMatches = [false, true].every(dither =>
+        ndi.convertVideo(p216, 'UYVY', { dither }).data.equals(
+            ndi.convertVideo(p216, 'UYVY', { dither, reference: true }).data));
+    const f216 = ndi.convertVideo(p216, 'F216');
+    const floats = new Float32Array(f216.data.buffer, f216.data.byteOffset, f216.data.length / 4);
+    const expected = p216.data.readUInt16LE(2) / 65535;
+    if (narrowMatches && f216.data.length === p216.data.length * 2 && Math.abs(floats[1] - expected) < 1e-6) {
+        console.log('✓ P216 narrows and unpacks to float like the scalar reference');
+    } else {
+        console.log('✗ P216 conversion differs from the scalar reference');
+    }
+
+    const nv12Rgba = ndi.convertVideo(nv12, 'RGBA');
+    if (nv12Rgba.data.equals(ndi.convertVideo(nv12, 'RGBA', { reference: true }).data) &&
+        ndi.convertVideo(nv12Rgba, 'YV12').data.equals(ndi.convertVideo(nv12Rgba, 'YV12', { reference: true }).data)) {
+        console.log('✓ NV12 <-> RGBA matches the scalar reference');
+    } else {
+        console.log('✗ NV12 <-> RGBA differs from the scalar reference');
+    }
+
+    // V210 keeps 10 bits, so P216 with the low 6 bits clear round trips exactly
+    const v210Source = {
+        xres: 60, yres: 2, fourCC: 'P216',
+        data: Buffer.alloc(60 * 2 * 2 * 2)
+    };
+    for (let i = 0; i < v210Source.data.length; i += 2) {
+        v210Source.data.writeUInt16LE((i * 997) & 0xFFC0, i);
+    }
+
+    const v210 = ndi.convertVideo(v210Source, 'V210');
+    if (v210.lineStrideInBytes === 128 * 2 &&
+        ndi.convertVideo(v210, 'P216').data.equals(v210Source.data)) {
+        console.log('✓ P216 -> V210 -> P216 round trips exactly');
+    } else {
+        console.log('✗ V210 round trip changed the frame');
+    }
+
+    // A flat frame stays flat through every filter, whatever the target size
+    const flat = {
+        xres: 64, yres: 36, fourCC: 'BGRA',
+        data: Buffer.alloc(64 * 36 * 4, 0x5A)
+    };
+    const half = ndi.scaleVideo(flat, { scale: 0.5 });
+    const thumb = ndi.scaleVideo(flat, { width: 20, filter: 'lanczos' });
+    if (half.xres === 32 && half.yres === 18 && half.data.every(v => v === 0x5A) &&
+        thumb.xres === 20 && thumb.yres === 11 && thumb.data.every(v => v === 0x5A)) {
+        console.log('✓ scaleVideo keeps a flat BGRA frame flat');
+    } else {
+        console.log('✗ scaleVideo changed a flat BGRA frame');
+    }
+
+    const clamped = ndi.scaleVideo(flat, { width: 100000 });
+    if (clamped.xres === 64 && clamped.yres === 36) {
+        console.log('✓ scaleVideo clamps an oversized target to the source');
+    } else {
+        console.log(`✗ scaleVideo produced ${clamped.xres}x${clamped.yres} for an oversized target`);
+    }
+} catch (e) {
+    console.log(`✗ Pixel conversion failed: ${e.message}`);
+}
+
+// Test 6: Initialize and version (requires NDI SDK)
 console.log('\n--- Testing NDI Initialization ---');
 
 try {
@@ -108,4 +238,36 @@ try {
     console.log('  This may be because the NDI runtime is not installed.');
 }
 
+// Test 7: A queue depth of one holds a single frame (requires NDI SDK)
+console.log('\n--- Testing Send Thread Depth ---');
+
+try {
+    if (ndi.initialize()) {
+        const sender = new ndi.Sender({ name: 'ndi-node depth test', clockVideo: false, clockAudio: false });
+        sender.startSendThread({ videoDepth: 1, audioDepth: 1 });
+        
+        // One frame a second, so the thread holds the first and the queue fills
+        const frame = {
+            xres: 16, yres: 16, fourCC: 'BGRA', frameRateN: 1, frameRateD: 1,
+            data: Buffer.alloc(16 * 16 * 4)
+        };
+        for (let i = 0; i < 3; i++) {
+            sender.enqueueVideo(frame);
+        }
+        
+        sender.stopSendThread();
+        const stats = sender.getSendStats();
+        if (stats.videoOverruns >= 1 && stats.videoDepth === 0) {
+            console.log('✓ videoDepth 1 overruns instead of overwriting, and stops cleanly');
+        } else {
+            console.log(`✗ videoDepth 1 reported ${stats.videoOverruns} overruns, depth ${stats.videoDepth}`);
+        }
+        
+        sender.destroy();
+        ndi.destroy();
+    }
+} catch (e) {
+    console.log(`✗ Send thread depth test failed: ${e.message}`);
+}
+
 console.log('\n=== Test Complete ===');